@@ -0,0 +1,109 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <avr/io.h>
+#include <avr/eeprom.h>
+
+#include "BlackBox.h"
+#include "Timer.h"
+
+#ifdef __AVR__
+#define BLACKBOX_NOINIT __attribute__((section(".noinit")))
+#else
+#define BLACKBOX_NOINIT
+#endif
+
+blackbox_log BlackBoxLog BLACKBOX_NOINIT;
+blackbox_log BlackBoxSaved EEMEM;
+
+static uint32_t polls = 0;
+static uint32_t last_poll_ms = 0;
+static uint16_t save_offset = sizeof(blackbox_log); // 次に EEPROM に書くバイト
+
+static void Append(const blackbox_entry* entry) {
+	BlackBoxLog.entries[BlackBoxLog.head] = *entry;
+	BlackBoxLog.head = (BlackBoxLog.head + 1) % BLACKBOX_ENTRIES;
+}
+
+void BlackBoxInit(uint8_t reset_cause) {
+	bool valid = BlackBoxLog.magic == BLACKBOX_MAGIC
+		&& BlackBoxLog.size == BLACKBOX_ENTRIES
+		&& BlackBoxLog.head < BLACKBOX_ENTRIES;
+
+	// 電源投入時の SRAM の中身は不定
+	if (!valid || (reset_cause & (1 << PORF))) {
+		memset(&BlackBoxLog, 0, sizeof(BlackBoxLog));
+		BlackBoxLog.magic = BLACKBOX_MAGIC;
+		BlackBoxLog.size = BLACKBOX_ENTRIES;
+	}
+	BlackBoxLog.saving = 0;
+
+	// ウォッチドッグ・ブラウンアウトで止まる直前の記録は、USB の接続前にここで保存してしまう
+	if (valid && (reset_cause & ((1 << WDRF) | (1 << BORF)))) {
+		BlackBoxLog.reason = BLACKBOX_BOOT;
+		eeprom_update_block(&BlackBoxLog, &BlackBoxSaved, sizeof(blackbox_log));
+	}
+
+	blackbox_entry boot = { 0 };
+	boot.event = BLACKBOX_BOOT;
+	boot.gap = reset_cause;
+	Append(&boot);
+
+	polls = 0;
+	last_poll_ms = TimerMillis();
+}
+
+uint16_t BlackBoxPoll(void) {
+	uint32_t now = TimerMillis();
+	uint32_t gap = now - last_poll_ms;
+
+	last_poll_ms = now;
+	polls++;
+	return (gap > UINT16_MAX) ? UINT16_MAX : gap;
+}
+
+void BlackBoxRecord(blackbox_entry* entry) {
+	entry->poll = polls;
+
+	// 保存中のリングバッファは書き換えない
+	if (BlackBoxLog.saving) {
+		if (BlackBoxLog.dropped < UINT16_MAX) {
+			BlackBoxLog.dropped++;
+		}
+		return;
+	}
+	Append(entry);
+}
+
+void BlackBoxSave(uint8_t reason) {
+	if (BlackBoxLog.saving) {
+		return;
+	}
+	BlackBoxLog.reason = reason;
+	BlackBoxLog.saving = 1;
+	save_offset = 0;
+}
+
+void BlackBoxTask(void) {
+	if (!BlackBoxLog.saving || !eeprom_is_ready()) {
+		return;
+	}
+
+	// 書き込みの完了を待たずに戻り、次の呼び出しで続きを書く
+	// saving は保存中でない状態 (0) で書き込む
+	const uint8_t* source = (const uint8_t*)&BlackBoxLog;
+	uint8_t value = source[save_offset];
+	if (save_offset == offsetof(blackbox_log, saving)) {
+		value = 0;
+	}
+	eeprom_update_byte((uint8_t*)&BlackBoxSaved + save_offset, value);
+
+	if (++save_offset == sizeof(blackbox_log)) {
+		BlackBoxLog.saving = 0;
+	}
+}
@@ -0,0 +1,87 @@
+/* Header file for BlackBox.c */
+
+/* ------------------------------------------------------------ */
+/* 直近のステップの切り替わりと異常を記録するブラックボックス   */
+/* 異常（ポーリングの途切れ、切断、リセット）で EEPROM に保存し */
+/* USB で読み出して、ホストのシミュレーターで再生できる         */
+/* ------------------------------------------------------------ */
+
+#ifndef _BLACKBOX_H_
+#define _BLACKBOX_H_
+
+#include <stdint.h>
+
+#ifndef BLACKBOX_ENTRIES
+#define BLACKBOX_ENTRIES 32 // リングバッファのエントリ数 (1 - 255)
+#endif
+#ifndef BLACKBOX_GAP_MS
+#define BLACKBOX_GAP_MS 100 // これ以上ポーリングが途切れたら異常として保存する（ミリ秒）
+#endif
+
+#define BLACKBOX_MAGIC   0xB10C // 記録が有効なときの blackbox_log.magic
+#define BLACKBOX_REQUEST 0x02   // 記録を返すベンダーリクエスト (bmRequestType 0xC0) の bRequest
+                                // wValue が BLACKBOX_RAM なら現在の記録、BLACKBOX_EEPROM なら保存された記録
+
+/* 記録の種類 */
+typedef enum {
+	BLACKBOX_EMPTY,      // まだ書かれていないエントリ
+	BLACKBOX_BOOT,       // 起動した（gap にリセットの原因 MCUSR）
+	BLACKBOX_STEP,       // state か step が変わり、そのステップの最初のフレームを作る直前
+	BLACKBOX_GAP,        // 前のポーリングから gap ミリ秒途切れた
+	BLACKBOX_DISCONNECT, // USB が切断された
+	BLACKBOX_RESUME,     // 中断（スリープ・切断・再接続・途切れ）から再開する（gap に LINK_* のビット）
+} blackbox_event;
+
+/* 読み出し元 (wValue) */
+enum {
+	BLACKBOX_RAM,
+	BLACKBOX_EEPROM,
+};
+
+/* 1つの記録（エンジンの状態は SeekIndex と同じく、レポートを作る直前の値） */
+typedef struct {
+	uint32_t poll;            // 起動してからの GetNextReport() の呼び出し回数
+	uint16_t gap;             // 前の呼び出しからの時間（ミリ秒、最大 0xFFFF）
+	uint16_t duration_count;
+	uint8_t  event;           // blackbox_event
+	uint8_t  state;           // State_t
+	uint8_t  step;            // Step_t
+	uint8_t  bufindex;
+	uint8_t  clear_count;
+	uint8_t  drone_count;
+	uint8_t  gyro_on;
+	int8_t   sensitivity_val;
+} blackbox_entry;
+
+/* リングバッファ全体（USB ではこの並びのリトルエンディアンで返す） */
+typedef struct {
+	uint16_t magic;   // BLACKBOX_MAGIC
+	uint8_t  size;    // BLACKBOX_ENTRIES
+	uint8_t  head;    // 次に書き込むエントリ（ここから古い順に並ぶ）
+	uint8_t  reason;  // 最後に EEPROM に保存したときの blackbox_event
+	uint8_t  saving;  // EEPROM に保存中なら 1
+	uint16_t dropped; // 保存中のため記録できなかった数
+	blackbox_entry entries[BLACKBOX_ENTRIES];
+} blackbox_log;
+
+extern blackbox_log BlackBoxLog;   // ウォッチドッグリセットでも消えない (.noinit)
+extern blackbox_log BlackBoxSaved; // EEPROM に保存された記録 (EEMEM)
+
+/* 電源投入時は記録を初期化し、それ以外のリセットでは記録を引き継ぐ */
+/* ウォッチドッグとブラウンアウトのリセットでは、引き継いだ記録をすぐに保存する */
+/* reset_cause はクリアする前の MCUSR */
+void BlackBoxInit(uint8_t reset_cause);
+
+/* 毎回の GetNextReport() の最初に呼び、前の呼び出しからの時間（ミリ秒）を返す */
+uint16_t BlackBoxPoll(void);
+
+/* 記録を追加する（poll は BlackBoxPoll() の回数） */
+void BlackBoxRecord(blackbox_entry* entry);
+
+/* 記録を EEPROM に保存し始める（保存中なら何もしない） */
+void BlackBoxSave(uint8_t reason);
+
+/* メインループで呼び、EEPROM の準備ができていれば 1 バイトずつ保存を進める */
+void BlackBoxTask(void);
+
+#endif
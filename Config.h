@@ -3,23 +3,74 @@
 /* ---------------------------- */
 /* 実行環境の設定を行うファイル */
 /* ---------------------------- */
+/* 各項目はコンパイル時の -D オプションでも上書きできる */
 
+#ifndef INFINITE_LOOP_MODE
 #define INFINITE_LOOP_MODE 0
+#endif
 // ステージ1-8の無限周回モードを使用する場合は1を入力
 // 4回周回後、ドローンを起動する場合は0
 
+#ifndef DRONE_CLEARS
+#define DRONE_CLEARS 4
+#endif
+// ドローンを1回起動するまでに、ステージ1-8をクリアする回数
+
+#ifndef DRONE_RUNS
+#define DRONE_RUNS 1
+#endif
+// 「DRONE_CLEARS 回周回してドローンを起動」を続けて行う回数
+// 2回以上の場合、途中ではジャイロ・感度の設定を戻さずに次の周回へ進む
+// INFINITE_LOOP_MODE・DRONE_CLEARS・DRONE_RUNS は、EEPROM に目標（Schedule.h）が無いときの設定
+// gadget/reader -g で目標を書き込むと、書き込み直さずに周回の組み合わせを変えられる
+
+#ifndef GYRO_SETTING
 #define GYRO_SETTING 1
+#endif
 // ジャイロ操作をONにしている場合は1、OFFの場合は0を入力
 
+#ifndef SENSITIVITY
 #define SENSITIVITY 5
+#endif
 // 設定感度の値を記述
 // 私の場合は操作感度を最大値の5にしているので、そのまま5と記述している
 
+#ifndef REVERSE_LR
 #define REVERSE_LR 0
+#endif
 // Rスティックの上下操作をリバースにしている場合は1を入力、ノーマルなら0
 
+#ifndef REVERSE_UD
 #define REVERSE_UD 0
+#endif
 // Rスティックの左右操作をリバースにしている場合は1を入力、ノーマルなら0
 
+#ifndef SOFT_TYPE
 #define SOFT_TYPE 0
-// DL版なら0、カセット版なら1
\ No newline at end of file
+#endif
+// DL版なら0、カセット版なら1
+
+#ifndef FAST_MENUS
+#define FAST_MENUS 0
+#endif
+// メニューの操作を短い入力と待機 (route.txt の FAST_MENUS) で行う場合は1を入力
+// 待機は sim/Console.c のモデルで確かめただけで実機では試していないため、0のまま出荷する
+
+#ifndef EARLY_HOLD_CREDIT
+#define EARLY_HOLD_CREDIT 0
+#endif
+// route.txt の accepts で先に押し始めた入力のフレームを、次のステップの長押しの時間に含める場合は1
+// ゲームは着地してからの長押ししか数えないため、着地が窓より前になると確かめられるまでは0
+
+#ifndef PRO_CONTROLLER
+#define PRO_CONTROLLER 0
+#endif
+// Pro コントローラーとして接続する場合は1、ホリのポッ拳コントローラーとして接続する場合は0
+// 1の場合、ジャイロ操作をONのまま (GYRO_SETTING 1) ピッチを IMU で入力し、ジャイロ操作の切り替えを省く
+
+#ifndef START_AT_KETTLE
+#define START_AT_KETTLE 0
+#endif
+// デバッグ用: 1-8ヤカン上でマイコンを接続する場合は1を入力
+// コントローラーの登録後、ルートの索引 (SeekIndex.c) を使って周回の先頭から始める
+// ジャイロ・感度はプログラム用の設定（ジャイロOFF・感度-5）になっている前提で進む
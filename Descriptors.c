@@ -1,6 +1,36 @@
 #include "Descriptors.h"
+#include "ProController.h"
 
 // HID Descriptors.
+#if PRO_CONTROLLER
+// The Pro Controller's reports are vendor defined, one 63-byte report per ID.
+// The Switch knows the layout from the VID/PID; the IDs are what it checks.
+#define PRO_REPORT(Id, Main) \
+		HID_RI_REPORT_ID(8,Id), \
+		HID_RI_USAGE(8,Id), \
+		Main(8,2)
+
+const USB_Descriptor_HIDReport_Datatype_t PROGMEM JoystickReport[] = {
+	HID_RI_USAGE_PAGE(8,1), /* Generic Desktop */
+	HID_RI_USAGE(8,4), /* Joystick */
+	HID_RI_COLLECTION(8,1), /* Application */
+		HID_RI_USAGE_PAGE(16,65280),
+		HID_RI_LOGICAL_MINIMUM(8,0),
+		HID_RI_LOGICAL_MAXIMUM(16,255),
+		HID_RI_REPORT_SIZE(8,8),
+		HID_RI_REPORT_COUNT(8,63),
+		// Input: full report, subcommand reply, USB command reply
+		PRO_REPORT(PRO_REPORT_FULL, HID_RI_INPUT),
+		PRO_REPORT(PRO_REPORT_REPLY, HID_RI_INPUT),
+		PRO_REPORT(PRO_REPORT_USB, HID_RI_INPUT),
+		// Output: rumble and subcommand, rumble only, USB command, USB pre-handshake
+		PRO_REPORT(PRO_OUT_SUBCOMMAND, HID_RI_OUTPUT),
+		PRO_REPORT(PRO_OUT_RUMBLE, HID_RI_OUTPUT),
+		PRO_REPORT(PRO_OUT_USB, HID_RI_OUTPUT),
+		PRO_REPORT(0x82, HID_RI_OUTPUT),
+	HID_RI_END_COLLECTION(0),
+};
+#else
 const USB_Descriptor_HIDReport_Datatype_t PROGMEM JoystickReport[] = {
 	HID_RI_USAGE_PAGE(8,1), /* Generic Desktop */
 	HID_RI_USAGE(8,5), /* Joystick */
@@ -56,6 +86,7 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM JoystickReport[] = {
 		HID_RI_OUTPUT(8,2),
 	HID_RI_END_COLLECTION(0),
 };
+#endif
 
 // Device Descriptor Structure
 const USB_Descriptor_Device_t PROGMEM DeviceDescriptor = {
@@ -68,9 +99,15 @@ const USB_Descriptor_Device_t PROGMEM DeviceDescriptor = {
 
 	.Endpoint0Size          = FIXED_CONTROL_ENDPOINT_SIZE,
 
+	#if PRO_CONTROLLER
+	.VendorID               = PRO_VENDOR_ID,
+	.ProductID              = PRO_PRODUCT_ID,
+	.ReleaseNumber          = VERSION_BCD(2,0,0),
+	#else
 	.VendorID               = 0x0F0D,
 	.ProductID              = 0x0092,
 	.ReleaseNumber          = VERSION_BCD(1,0,0),
+	#endif
 
 	.ManufacturerStrIndex   = STRING_ID_Manufacturer,
 	.ProductStrIndex        = STRING_ID_Product,
@@ -148,8 +185,13 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
 const USB_Descriptor_String_t PROGMEM LanguageString = USB_STRING_DESCRIPTOR_ARRAY(LANGUAGE_ID_ENG);
 
 // Manufacturer and Product Descriptor Strings
+#if PRO_CONTROLLER
+const USB_Descriptor_String_t PROGMEM ManufacturerString = USB_STRING_DESCRIPTOR(L"Nintendo Co., Ltd.");
+const USB_Descriptor_String_t PROGMEM ProductString      = USB_STRING_DESCRIPTOR(L"Pro Controller");
+#else
 const USB_Descriptor_String_t PROGMEM ManufacturerString = USB_STRING_DESCRIPTOR(L"HORI CO.,LTD.");
 const USB_Descriptor_String_t PROGMEM ProductString      = USB_STRING_DESCRIPTOR(L"POKKEN CONTROLLER");
+#endif
 
 // USB Device Callback - Get Descriptor
 uint16_t CALLBACK_USB_GetDescriptor(
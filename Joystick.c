@@ -20,6 +20,48 @@ these buttons for our use.
 
 #include "Joystick.h"
 
+// What the main loop has got done since the watchdog was last kicked.
+#define PROGRESS_ENGINE 0x01 // HID_Task delivered a report, or the host was not asking for one
+#define PROGRESS_USB    0x02 // USB_USBTask serviced the control endpoint and the bus events
+static uint8_t progress = 0;
+
+// The watchdog is only kicked once both have made progress, so a spin in
+// either of them (a stream that never completes) resets the controller.
+static void Progress(uint8_t made) {
+	progress |= made;
+	if (progress == (PROGRESS_ENGINE | PROGRESS_USB)) {
+		wdt_reset();
+		progress = 0;
+	}
+}
+
+// Frames the engine has made in a row without playing the route: the neutral
+// reports and the END between steps. Past ENGINE_IDLE_FRAMES the engine is
+// caught in a loop of its own, and its reports no longer count as progress.
+#define ENGINE_IDLE_FRAMES 64
+uint8_t idle_frames = 0;
+
+// Where the last reset came from, kept in .noinit as .bss is cleared after .init3.
+#ifdef __AVR__
+#define RESET_NOINIT __attribute__((section(".noinit")))
+#else
+#define RESET_NOINIT
+#endif
+static uint8_t reset_cause RESET_NOINIT;
+
+// A watchdog reset leaves the watchdog running at its shortest timeout, which
+// would fire again long before SetupHardware() has painted the SRAM. So the
+// reset flags are read and cleared, and the watchdog stopped, in .init3 before
+// the C runtime starts. The next reset then reports only its own cause.
+#ifdef __AVR__
+static void WatchdogOff(void) __attribute__((naked, used, section(".init3")));
+#endif
+static void WatchdogOff(void) {
+	reset_cause = MCUSR;
+	MCUSR = 0;
+	wdt_disable();
+}
+
 // Main entry point.
 int main(void) {
 	// We'll start by performing hardware and peripheral setup.
@@ -33,14 +75,20 @@ int main(void) {
 		HID_Task();
 		// We also need to run the main USB management task.
 		USB_USBTask();
+		Progress(PROGRESS_USB);
+		// Timed background work (black box saves, alerts) runs one task at a time between the USB tasks.
+		TaskRun();
 	}
 }
 
 // Configures hardware and peripherals, such as the USB peripherals.
 void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
+	// On the AVR, WatchdogOff() has already disabled the watchdog left by the bootloader, the fuses or the reset.
+	#ifndef __AVR__
+	WatchdogOff();
+	#endif
+	// We paint the unused SRAM first, so MemoryUsage() can find how deep the stack has been.
+	MemoryPaint();
 
 	// We need to disable clock division before initializing the USB hardware.
 	clock_prescale_set(clock_div_1);
@@ -56,8 +104,25 @@ PORTD will toggle when printing is done.
 	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
 	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
 	#endif
+	// The millisecond clock, and the black box that keeps what happened before a reset.
+	TimerInit();
+	BlackBoxInit(reset_cause);
+	// The black box writes to EEPROM a byte at a time, on every pass of the main loop.
+	TaskStart(TASK_BLACKBOX, BlackBoxTask, 0);
+	// The goal of the scheduler sets the clears per drone run; a new one is saved the same way.
+	ScheduleInit();
+	TaskStart(TASK_SCHEDULE, ScheduleTask, 0);
+	// A program uploaded to EEPROM replaces the flash tables it carries; it is written the same way.
+	MacroInit();
+	TaskStart(TASK_MACRO, MacroTask, 0);
+
+	// A watchdog or brown-out reset in the middle of the route goes straight back to it.
+	Recover(reset_cause);
+
 	// The USB stack should be initialized last.
 	USB_Init();
+	// From here on, the main loop must keep making progress (the black box above saved without it).
+	wdt_enable(WATCHDOG_TIMEOUT);
 }
 
 // Fired to indicate that the device is enumerating.
@@ -68,6 +133,18 @@ void EVENT_USB_Device_Connect(void) {
 // Fired to indicate that the device is no longer connected to a host.
 void EVENT_USB_Device_Disconnect(void) {
 	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
+
+	// We keep the black box of what led to the disconnect.
+	RecordState(BLACKBOX_DISCONNECT, 0);
+	BlackBoxSave(BLACKBOX_DISCONNECT);
+	// The route resumes once the host polls again.
+	link_lost |= LINK_DISCONNECT;
+}
+
+// Fired when the host suspends the bus, e.g. when the console goes to sleep.
+void EVENT_USB_Device_Suspend(void) {
+	// The console drops the controller while it sleeps; the route resumes once the host polls again.
+	link_lost |= LINK_SUSPEND;
 }
 
 // Fired when the host set the current configuration of the USB device after enumeration.
@@ -77,6 +154,10 @@ void EVENT_USB_Device_ConfigurationChanged(void) {
 	// We setup the HID report endpoints.
 	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
 	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
+	// A Pro Controller starts every connection with the handshake.
+	ProControllerReset();
+	// Enumerated again after the route started (the console woke up or was docked): the route resumes.
+	link_lost |= LINK_RECONFIGURE;
 
 	// We can read ConfigSuccess to indicate a success or failure at this point.
 }
@@ -86,13 +167,88 @@ void EVENT_USB_Device_ControlRequest(void) {
 	// We can handle two control requests: a GetReport and a SetReport.
 
 	// Not used here, it looks like we don't receive control request from the Switch.
+
+	// Vendor requests are ours, for tools on a PC (see gadget/Reader.c).
+	switch (USB_ControlRequest.bRequest) {
+		case MEMORY_REQUEST:
+			if (USB_ControlRequest.bmRequestType == (REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE)) {
+				memory_usage usage = MemoryUsage();
+
+				Endpoint_ClearSETUP();
+				Endpoint_Write_Control_Stream_LE(&usage, sizeof(usage));
+				Endpoint_ClearOUT();
+			}
+			break;
+
+		case BLACKBOX_REQUEST:
+			if (USB_ControlRequest.bmRequestType == (REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE)) {
+				Endpoint_ClearSETUP();
+				if (USB_ControlRequest.wValue == BLACKBOX_EEPROM) {
+					Endpoint_Write_Control_EStream_LE(&BlackBoxSaved, sizeof(blackbox_log));
+				} else {
+					Endpoint_Write_Control_Stream_LE(&BlackBoxLog, sizeof(blackbox_log));
+				}
+				Endpoint_ClearOUT();
+			}
+			break;
+
+		case SCHEDULE_REQUEST:
+			if (USB_ControlRequest.bmRequestType == (REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE)) {
+				schedule_report report = ScheduleReport();
+
+				Endpoint_ClearSETUP();
+				Endpoint_Write_Control_Stream_LE(&report, SCHEDULE_REPORT_SIZE);
+				Endpoint_ClearOUT();
+			} else if (USB_ControlRequest.bmRequestType == (REQDIR_HOSTTODEVICE | REQTYPE_VENDOR | REQREC_DEVICE)
+				&& USB_ControlRequest.wLength == SCHEDULE_GOAL_SIZE) {
+				// A new goal; the host reads the plan back to see whether it was taken.
+				schedule_goal goal;
+
+				Endpoint_ClearSETUP();
+				Endpoint_Read_Control_Stream_LE(&goal, sizeof(goal));
+				Endpoint_ClearIN();
+				ScheduleSet(&goal);
+			}
+			break;
+
+		case MACRO_REQUEST:
+			if (USB_ControlRequest.bmRequestType == (REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE)) {
+				macro_status status = MacroStatus();
+
+				Endpoint_ClearSETUP();
+				Endpoint_Write_Control_Stream_LE(&status, sizeof(status));
+				Endpoint_ClearOUT();
+			} else if (USB_ControlRequest.bmRequestType == (REQDIR_HOSTTODEVICE | REQTYPE_VENDOR | REQREC_DEVICE)) {
+				// A part of a program at the offset wValue; the host waits for the status to be no longer busy before the next.
+				uint16_t length = USB_ControlRequest.wLength;
+
+				if (USB_ControlRequest.wIndex == MACRO_WRITE && MacroWritable(USB_ControlRequest.wValue, length)) {
+					uint8_t data[MACRO_CHUNK];
+
+					Endpoint_ClearSETUP();
+					Endpoint_Read_Control_Stream_LE(data, length);
+					Endpoint_ClearIN();
+					MacroWrite(USB_ControlRequest.wValue, data, length);
+				} else if (length == 0 && ((USB_ControlRequest.wIndex == MACRO_COMMIT && MacroCommit())
+					|| (USB_ControlRequest.wIndex == MACRO_ERASE && MacroErase()))) {
+					// The host reads the status back to see whether the program was taken.
+					Endpoint_ClearSETUP();
+					Endpoint_ClearStatusStage();
+				}
+			}
+			break;
+	}
 }
 
 // Process and deliver data from IN and OUT endpoints.
 void HID_Task(void) {
 	// If the device isn't connected and properly configured, we can't do anything here.
 	if (USB_DeviceState != DEVICE_STATE_Configured)
+	{
+		// Nor is the engine expected to: the console may sleep for hours.
+		Progress(PROGRESS_ENGINE);
 		return;
+	}
 
 	// We'll start with the OUT endpoint.
 	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
@@ -102,6 +258,15 @@ void HID_Task(void) {
 		// If we did, and the packet has data, we'll react to it.
 		if (Endpoint_IsReadWriteAllowed())
 		{
+			#if PRO_CONTROLLER
+			// As a Pro Controller, the host drives the handshake and subcommands with its OUT reports.
+			uint8_t ProOutputData[PRO_REPORT_SIZE];
+			uint16_t length = Endpoint_BytesInEndpoint();
+			if (length > sizeof(ProOutputData))
+				length = sizeof(ProOutputData);
+			while(Endpoint_Read_Stream_LE(ProOutputData, length, NULL) != ENDPOINT_RWSTREAM_NoError);
+			ProControllerOut(ProOutputData, length);
+			#else
 			// We'll create a place to store our data received from the host.
 			USB_JoystickReport_Output_t JoystickOutputData;
 			// We'll then take in that data, setting it up in our storage.
@@ -109,6 +274,7 @@ void HID_Task(void) {
 			// At this point, we can react to this data.
 
 			// However, since we're not doing anything with this data, we abandon it.
+			#endif
 		}
 		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
 		Endpoint_ClearOUT();
@@ -117,6 +283,28 @@ void HID_Task(void) {
 	// We'll then move on to the IN endpoint.
 	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
 	// We first check to see if the host is ready to accept data.
+	#if PRO_CONTROLLER
+	if (Endpoint_IsINReady())
+	{
+		uint8_t ProInputData[PRO_REPORT_SIZE];
+		// Replies to the host come first. The route only runs once the handshake is over.
+		if (!ProControllerReply(ProInputData))
+		{
+			if (!ProControllerStreaming())
+			{
+				Progress(PROGRESS_ENGINE);
+				return;
+			}
+			USB_JoystickReport_Input_t JoystickInputData;
+			pro_input input;
+			GetNextReport(&JoystickInputData);
+			ProInput(&JoystickInputData, &input);
+			ProControllerFull(&input, ProInputData);
+		}
+		while(Endpoint_Write_Stream_LE(ProInputData, sizeof(ProInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
+		Endpoint_ClearIN();
+	}
+	#else
 	if (Endpoint_IsINReady())
 	{
 		// We'll create an empty report.
@@ -128,35 +316,21 @@ void HID_Task(void) {
 		// We then send an IN packet on this endpoint.
 		Endpoint_ClearIN();
 	}
+	#endif
+	// The report is on its way, or the host has not asked for one since the last;
+	// either is progress while the engine still gets to the route's inputs.
+	if (idle_frames <= ENGINE_IDLE_FRAMES) {
+		Progress(PROGRESS_ENGINE);
+	}
 }
 
-typedef enum {
-	SYNC_POSITION,
-	BREATHE,
-	PROCESS,
-	DONE
-} State_t;
 State_t state = SYNC_POSITION;
-
-typedef enum {
-	CONNECT_CONTROLLER,
-	SYNC_CONTROLLER,
-	GO_TO_ALTERNA,
-	OPEN_OPTION,
-	TURN_OFF_GYRO,
-	SET_SENSITIVITY,
-	JUMP_TO_STAGE,
-	ENTER_STAGE,
-	CLEAR_STAGE,
-	LUNCH_DRONE,
-	RESET_SENSITIVITY,
-	RESET_GYRO_SETTING,
-	BACK_TO_SPLATSVILLE,
-} Step_t;
 Step_t step = CONNECT_CONTROLLER;
 
 command tmp;
 
+// Every report is sent 1 + echoes times. The neutral reports between steps
+// use ECHOES; the frames of a step use the echo count of its route.txt phase.
 #define ECHOES 2
 int echoes = 0;
 USB_JoystickReport_Input_t last_report;
@@ -166,15 +340,669 @@ int bufindex = 0;
 int duration_count = 0;
 int report_count = 0;
 
-int cnt = 0;
 int flag = 0;
 int mode = 0;
-int clear_count = 0; // ステージ1-8をクリアした回数をカウント
+int clear_count = 0; // ステージ1-8をクリアした回数をカウント（ドローンを起動するたびに 0）
+int drone_count = 0; // ドローンを起動した回数をカウント
+
+// ゲーム内のオプション設定は、変更するたびにここで記録しておく
+// 設定が既に目的の状態なら、そのステップでは何も入力しない
+int gyro_on = GYRO_SETTING; // 現在のジャイロ操作の設定
 int sensitivity_set = -5 * 2; // プログラムで用いる操作感度を2倍
-int sensitivity_val = SENSITIVITY * 2;
+int sensitivity_val = SENSITIVITY * 2; // 現在の操作感度を2倍
+int sensitivity_target = 0;
 
 int portsval = 0;
 
+// Interruptions seen by the USB events and the poll clock (LINK_* bits).
+volatile uint8_t link_lost = 0;
+
+// What RECONNECT plays after an interruption, lowest bit first, and where the route then resumes.
+#define RECONNECT_SYNC  0x01 // SyncController: register the controller again
+#define RECONNECT_MENUS 0x02 // CloseMenus: back to the field
+#define RECONNECT_QUIT  0x04 // QuitStage: out of a stage that was left half played
+uint8_t reconnect_parts = 0;
+Step_t resume_step = OPEN_OPTION;
+int resume_bufindex = 0;
+
+// The first command of the next step, played early in the window of a wait (route.txt: accepts).
+command packed;
+Step_t packed_step;
+uint16_t packed_polls = 0; // polls it has been sent for so far
+
+// Where the engine was at its last report, in SRAM that a reset does not clear.
+#ifdef __AVR__
+#define RECOVERY_NOINIT __attribute__((section(".noinit")))
+#else
+#define RECOVERY_NOINIT
+#endif
+#define RECOVERY_MAGIC 0x7E5C
+typedef struct {
+	uint16_t magic;  // RECOVERY_MAGIC once the fields below are whole
+	uint8_t  resets; // resets since RECONNECT last completed
+	uint8_t  state;
+	uint8_t  step;
+	uint8_t  flag;
+	uint8_t  mode;
+	uint8_t  gyro_on;
+	int8_t   sensitivity_val;
+	uint8_t  reconnect_parts;
+	uint8_t  resume_step;
+	uint8_t  clear_count;
+	uint8_t  drone_count;
+	uint16_t bufindex;
+	uint16_t resume_bufindex;
+	uint16_t duration_count;
+	command  tmp;
+} recovery_point;
+recovery_point recovery RECOVERY_NOINIT;
+
+// What survives a reset has to fit the part named by MCU in the makefile. The
+// black box, the recovery point and the SRAM copy of the program (Macro.c)
+// stay out of the way of LUFA, the engine and the stack in at most half the
+// SRAM; parts such as the atmega16u2 (512 bytes of each) fail here rather than
+// at run time.
+_Static_assert(sizeof(blackbox_log) + sizeof(schedule_goal) + MACRO_SIZE <= E2END + 1,
+	"the black box, the schedule goal and the macro program do not fit the EEPROM: lower BLACKBOX_ENTRIES or MACRO_SIZE");
+_Static_assert(sizeof(blackbox_log) + sizeof(recovery_point) + MACRO_SIZE <= (RAMEND - RAMSTART + 1) / 2,
+	"the black box, the recovery point and the program take more than half the SRAM: lower BLACKBOX_ENTRIES or MACRO_SIZE");
+
+// Keep the engine's place after every report it makes. The magic is cleared
+// first, so a reset halfway through leaves no point to recover from.
+static void KeepRecoveryPoint(void) {
+	recovery.magic = 0;
+	// Once RECONNECT is over, the route has recovered.
+	if (step != RECONNECT) {
+		recovery.resets = 0;
+	}
+	recovery.state = state;
+	recovery.step = step;
+	recovery.flag = flag;
+	recovery.mode = mode;
+	recovery.gyro_on = gyro_on;
+	recovery.sensitivity_val = sensitivity_val;
+	recovery.reconnect_parts = reconnect_parts;
+	recovery.resume_step = resume_step;
+	recovery.clear_count = clear_count;
+	recovery.drone_count = drone_count;
+	recovery.bufindex = bufindex;
+	recovery.resume_bufindex = resume_bufindex;
+	recovery.duration_count = duration_count;
+	recovery.tmp = tmp;
+	recovery.magic = RECOVERY_MAGIC;
+}
+
+void Recover(uint8_t reset_cause) {
+	bool valid = recovery.magic == RECOVERY_MAGIC
+		&& recovery.state <= DONE
+		&& recovery.step <= RECONNECT && recovery.resume_step < RECONNECT;
+
+	// Power-on and the reset button start the route over; so does a route
+	// that keeps resetting before it gets through RECONNECT.
+	recovery.magic = 0;
+	if (!valid || !(reset_cause & ((1 << WDRF) | (1 << BORF)))
+		|| recovery.step == CONNECT_CONTROLLER || ++recovery.resets > RECOVERY_MAX_RESETS) {
+		recovery.resets = 0;
+		return;
+	}
+
+	state = recovery.state;
+	step = recovery.step;
+	flag = recovery.flag;
+	mode = recovery.mode;
+	gyro_on = recovery.gyro_on;
+	sensitivity_val = recovery.sensitivity_val;
+	reconnect_parts = recovery.reconnect_parts;
+	resume_step = recovery.resume_step;
+	clear_count = recovery.clear_count;
+	drone_count = recovery.drone_count;
+	bufindex = recovery.bufindex;
+	resume_bufindex = recovery.resume_bufindex;
+	duration_count = recovery.duration_count;
+	tmp = recovery.tmp;
+
+	if (state == DONE) {
+		#ifdef ALERT_WHEN_DONE
+		TaskStart(TASK_ALERT, AlertTask, 250);
+		#endif
+		return;
+	}
+	// The console dropped the controller with the reset: the first poll plays RECONNECT.
+	link_lost |= LINK_RESET;
+}
+
+#ifdef ALERT_WHEN_DONE
+// Flash the LED(s) and sound the buzzer if attached, every 250 ms once the route is done.
+void AlertTask(void) {
+	portsval = ~portsval;
+	PORTD = portsval;
+	PORTB = portsval;
+}
+#endif
+
+// The state and step of the last black box record.
+uint8_t recorded_state = 0xFF;
+uint8_t recorded_step = 0xFF;
+
+// Record the engine state in the black box.
+void RecordState(uint8_t event, uint16_t gap) {
+	blackbox_entry entry = {
+		.gap             = gap,
+		.duration_count  = duration_count,
+		.event           = event,
+		.state           = state,
+		.step            = step,
+		.bufindex        = bufindex,
+		.clear_count     = clear_count,
+		.drone_count     = drone_count,
+		.gyro_on         = gyro_on,
+		.sensitivity_val = sensitivity_val,
+	};
+
+	BlackBoxRecord(&entry);
+}
+
+// Convert a report to the input of a Pro Controller report: the same buttons
+// and 12-bit sticks, with the controller lying still.
+static uint16_t ProStick(uint8_t value, bool up) {
+	int16_t offset = ((int16_t)value - STICK_CENTER) * 16;
+	int16_t stick = PRO_STICK_CENTER + (up ? -offset : offset);
+	return (stick > 4095) ? 4095 : stick;
+}
+
+void ProInput(const USB_JoystickReport_Input_t* const ReportData, pro_input* input) {
+	static const uint8_t Hat[8] PROGMEM = {
+		PRO_UP, PRO_UP | PRO_RIGHT, PRO_RIGHT, PRO_DOWN | PRO_RIGHT,
+		PRO_DOWN, PRO_DOWN | PRO_LEFT, PRO_LEFT, PRO_UP | PRO_LEFT,
+	};
+	uint16_t button = ReportData->Button;
+
+	input->right  = ((button & SWITCH_Y) ? PRO_Y : 0) | ((button & SWITCH_X) ? PRO_X : 0)
+		| ((button & SWITCH_B) ? PRO_B : 0) | ((button & SWITCH_A) ? PRO_A : 0)
+		| ((button & SWITCH_R) ? PRO_R : 0) | ((button & SWITCH_ZR) ? PRO_ZR : 0);
+	input->shared = ((button & SWITCH_MINUS) ? PRO_MINUS : 0) | ((button & SWITCH_PLUS) ? PRO_PLUS : 0)
+		| ((button & SWITCH_RCLICK) ? PRO_RCLICK : 0) | ((button & SWITCH_LCLICK) ? PRO_LCLICK : 0)
+		| ((button & SWITCH_HOME) ? PRO_HOME : 0) | ((button & SWITCH_CAPTURE) ? PRO_CAPTURE : 0);
+	input->left   = ((button & SWITCH_L) ? PRO_L : 0) | ((button & SWITCH_ZL) ? PRO_ZL : 0)
+		| ((ReportData->HAT < 8) ? pgm_read_byte(&Hat[ReportData->HAT]) : 0);
+
+	input->lx = ProStick(ReportData->LX, false);
+	input->ly = ProStick(ReportData->LY, true);
+	input->rx = ProStick(ReportData->RX, false);
+	input->ry = ProStick(ReportData->RY, true);
+	input->pitch = 0;
+	input->yaw = 0;
+}
+
+// Apply a single command's input to the report.
+void ApplyButton(USB_JoystickReport_Input_t* const ReportData, Buttons_t button) {
+
+	switch (button) {
+		
+		case L_UP:
+			ReportData->LY = STICK_MIN;
+			break;
+		
+		case L_DOWN:
+			ReportData->LY = STICK_MAX;
+			break;
+		
+		case L_LEFT:
+			ReportData->LX = STICK_MIN;
+			break;
+		
+		case L_RIGHT:
+			ReportData->LX = STICK_MAX;
+			break;
+		
+		case R_UP:
+			if (!REVERSE_UD) {
+				ReportData->RY = STICK_MIN;
+			} else {
+				ReportData->RY = STICK_MAX;
+			}
+			break;
+		
+		case R_DOWN:
+			if (!REVERSE_UD) {
+				ReportData->RY = STICK_MAX;
+			} else {
+				ReportData->RY = STICK_MIN;
+			}
+			break;
+		
+		case R_LEFT:
+			if (!REVERSE_LR) {
+				ReportData->RX = STICK_MIN;
+			} else {
+				ReportData->RX = STICK_MAX;
+			}
+			break;
+		
+		case R_RIGHT:
+			if (!REVERSE_LR) {
+				ReportData->RX = STICK_MAX;
+			} else {
+				ReportData->RX = STICK_MIN;
+			}
+			break;
+		
+		case TOP:
+			ReportData->HAT = HAT_TOP;
+			break;
+		
+		case BOTTOM:
+			ReportData->HAT = HAT_BOTTOM;
+			break;
+		
+		case LEFT:
+			ReportData->HAT = HAT_LEFT;
+			break;
+		
+		case RIGHT:
+			ReportData->HAT = HAT_RIGHT;
+			break;
+		
+		case A:
+			ReportData->Button |= SWITCH_A;
+			break;
+		
+		case B:
+			ReportData->Button |= SWITCH_B;
+			break;
+		
+		case X:
+			ReportData->Button |= SWITCH_X;
+			break;
+		
+		case Y:
+			ReportData->Button |= SWITCH_Y;
+			break;
+		
+		case L:
+			ReportData->Button |= SWITCH_L;
+			break;
+		
+		case R:
+			ReportData->Button |= SWITCH_R;
+			break;
+		
+		case ZL:
+			ReportData->Button |= SWITCH_ZL;
+			break;
+		
+		case ZR:
+			ReportData->Button |= SWITCH_ZR;
+			break;
+		
+		case MINUS:
+			ReportData->Button |= SWITCH_MINUS;
+			break;
+		
+		case PLUS:
+			ReportData->Button |= SWITCH_PLUS;
+			break;
+		
+		case TRIGGERS:
+			ReportData->Button |= SWITCH_L | SWITCH_R;
+			break;
+		
+		case AIM_SHOT:
+			ReportData->Button |= SWITCH_ZR;
+			if (!REVERSE_UD) {
+				ReportData->RY = STICK_CENTER - 36;
+			} else {
+				ReportData->RY = STICK_CENTER + 36;
+			}
+			if (!REVERSE_LR) {
+				ReportData->RX = STICK_CENTER - 22;
+			} else {
+				ReportData->RX = STICK_CENTER + 22;
+			}					
+			break;
+
+		case AIM_MAP:
+			ReportData->LX = STICK_MIN;
+			ReportData->LY = 192;
+			break;
+		
+		case JUMP:
+			ReportData->Button |= SWITCH_B;
+			ReportData->LY = STICK_MIN;
+			break;
+		
+		case MERGED:
+			// The tracks of a timeline have already been merged into the report.
+			break;
+		
+		default:
+			ReportData->LX = STICK_CENTER;
+			ReportData->LY = STICK_CENTER;
+			ReportData->RX = STICK_CENTER;
+			ReportData->RY = STICK_CENTER;
+			ReportData->HAT = HAT_CENTER;
+			break;
+	}
+}
+
+// Merge the tracks of a timeline phase into one report.
+// Every track is a list of commands with its own durations, and frame is the
+// offset from the start of the phase. A track that has reached END is idle.
+command MergeTracks(USB_JoystickReport_Input_t* const ReportData, command (*timeline)(int, int), int frame) {
+	command merged = { END, 0, ECHOES };
+
+	for (int track = 0; track < TRACK_COUNT; track++) {
+		int start = 0;
+
+		for (int index = 0; ; index++) {
+			command cmd = timeline(track, index);
+			// Every track of a phase plays at the phase's echo count.
+			merged.echoes = cmd.echoes;
+
+			if (cmd.button == END) {
+				break;
+			}
+
+			if (frame <= start + cmd.duration) {
+				if (cmd.button != NOTHING) {
+					ApplyButton(ReportData, cmd.button);
+				}
+				// The phase lasts as long as its longest track.
+				merged.button = MERGED;
+				merged.duration = UINT16_MAX;
+				break;
+			}
+
+			start += cmd.duration + 1;
+		}
+	}
+
+	return merged;
+}
+
+// Restore the engine state recorded in an index entry, then move forward
+// to the requested frame within that command.
+static void SeekEntry(uint16_t index, uint32_t frame) {
+	seek_entry entry;
+	memcpy_P(&entry, &SeekIndex[index], sizeof(seek_entry));
+
+	state = PROCESS;
+	echoes = 0;
+	packed_polls = 0;
+	step = entry.step;
+	bufindex = entry.bufindex;
+	duration_count = entry.duration_count + (frame - entry.frame);
+	clear_count = entry.clear_count;
+	drone_count = entry.drone_count;
+	gyro_on = entry.gyro_on;
+	sensitivity_val = entry.sensitivity_val;
+}
+
+// Jump the engine to an absolute frame of the route.
+// Frames count generated reports from the start of CONNECT_CONTROLLER; each
+// one is then echoed to the host as many more times as its phase asks.
+bool SeekFrame(uint32_t frame) {
+	if (SeekIndexSize == 0) {
+		return false;
+	}
+
+	if (frame >= SeekEndFrame) {
+		if (SeekLoopFrame == SEEK_NO_LOOP) {
+			return false;
+		}
+		frame = SeekLoopFrame + (frame - SeekLoopFrame) % (SeekEndFrame - SeekLoopFrame);
+	}
+
+	// We look for the last command that starts at or before the frame.
+	uint16_t low = 0;
+	uint16_t high = SeekIndexSize - 1;
+	while (low < high) {
+		uint16_t mid = (low + high + 1) / 2;
+		if (pgm_read_dword(&SeekIndex[mid].frame) <= frame) {
+			low = mid;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	SeekEntry(low, frame);
+	return true;
+}
+
+// Jump the engine to the first frame of a step.
+bool SeekPhase(Step_t phase) {
+	if (phase >= SeekPhaseCount) {
+		return false;
+	}
+
+	uint16_t index = pgm_read_word(&SeekPhaseStart[phase]);
+	if (index == SEEK_NONE) {
+		return false;
+	}
+
+	SeekEntry(index, pgm_read_dword(&SeekIndex[index].frame));
+	// The route may have entered the step with its first input already held
+	// (PackEarly); played from here, that input starts from its first frame.
+	duration_count = 0;
+	return true;
+}
+
+// Whether the command at index of the current step has reached the console,
+// at least its first frame. After an END frame, duration_count already counts
+// one frame that the new repetition or step has not made yet.
+static bool Sent(int index) {
+	return index >= 0 && (bufindex > index || (bufindex == index && duration_count > 0 && tmp.button != END));
+}
+
+// The index of the first command of a phase with this button, or -1.
+static int FindEntry(command (*phase)(int), Buttons_t button) {
+	for (int index = 0; ; index++) {
+		command cmd = phase(index);
+		if (cmd.button == button) {
+			return index;
+		}
+		if (cmd.button == END) {
+			return -1;
+		}
+	}
+}
+
+// The index of the last command of a phase that is not a wait, or -1.
+// Once it has been sent, the phase has done what it does and only waits.
+static int LastInput(command (*phase)(int)) {
+	int last = -1;
+
+	for (int index = 0; ; index++) {
+		command cmd = phase(index);
+		if (cmd.button == END) {
+			return last;
+		}
+		if (cmd.button != NOTHING) {
+			last = index;
+		}
+	}
+}
+
+// The host stopped polling, or the controller was suspended, unplugged or
+// enumerated again: the console may have moved on, and the step's timing is
+// stale. Keep the options the interrupted step has already changed, then play
+// RECONNECT and resume at a step that is safe to start from where the console
+// was left, or after the last input of a step that has only its wait left.
+static void Resume(uint8_t cause) {
+	int index;
+
+	RecordState(BLACKBOX_RESUME, cause);
+	BlackBoxSave(BLACKBOX_RESUME);
+
+	// A controller the console has dropped must be registered again; after a
+	// plain gap it is still registered, and L+R and A would reach the game.
+	uint8_t parts = RECONNECT_MENUS | ((cause & ~LINK_GAP) ? RECONNECT_SYNC : 0);
+	if (step != RECONNECT) {
+		// Every menu step starts over from the field of Alterna, through OPEN_OPTION.
+		resume_step = OPEN_OPTION;
+		resume_bufindex = 0;
+	}
+
+	switch (step) {
+		case SYNC_CONTROLLER:
+			parts |= RECONNECT_SYNC;
+			resume_step = GO_TO_ALTERNA;
+			break;
+
+		case GO_TO_ALTERNA:
+			index = LastInput(GoToAlterna);
+			resume_step = GO_TO_ALTERNA;
+			resume_bufindex = Sent(index) ? index + 1 : 0;
+			break;
+
+		case TURN_OFF_GYRO:
+			if (gyro_on && Sent(FindEntry(TurnOffGyro, A))) {
+				gyro_on = 0;
+			}
+			break;
+
+		case SET_SENSITIVITY:
+		case RESET_SENSITIVITY:
+			if (flag == 0 && Sent(0)) {
+				sensitivity_val += mode ? -1 : 1;
+			}
+			break;
+
+		case RESET_GYRO_SETTING:
+			if (gyro_on != GYRO_SETTING && Sent(FindEntry(ResetGyroSetting, A))) {
+				gyro_on = GYRO_SETTING;
+			}
+			break;
+
+		case JUMP_TO_STAGE:
+			// Once the jump is confirmed, only the landing is left to wait for.
+			index = LastInput(JumpToStage);
+			if (Sent(index)) {
+				resume_step = JUMP_TO_STAGE;
+				resume_bufindex = index + 1;
+			}
+			break;
+
+		case ENTER_STAGE:
+			// ZL only enters the stage when it was held for the whole command.
+			index = LastInput(EnterStage);
+			resume_step = ENTER_STAGE;
+			resume_bufindex = (bufindex > index) ? index + 1 : 0;
+			break;
+
+		case CLEAR_STAGE:
+			// A stage cannot be resumed halfway: leave it and enter it again.
+			index = LastInput(ClearStage);
+			if (Sent(index)) {
+				resume_step = CLEAR_STAGE;
+				resume_bufindex = index + 1;
+			} else {
+				parts |= RECONNECT_QUIT;
+				resume_step = ENTER_STAGE;
+			}
+			break;
+
+		case LUNCH_DRONE:
+			// Nor can a drone run: it counts as done, and the next one starts from the menu.
+			drone_count++;
+			clear_count = 0;
+			break;
+
+		case BACK_TO_SPLATSVILLE:
+			index = LastInput(BackToSplatsville);
+			resume_step = BACK_TO_SPLATSVILLE;
+			resume_bufindex = Sent(index) ? index + 1 : 0;
+			break;
+
+		case RECONNECT:
+			// Interrupted again: the parts not yet done start over.
+			parts |= reconnect_parts;
+			break;
+
+		default:
+			break;
+	}
+
+	reconnect_parts = parts;
+	packed_polls = 0;
+	step = RECONNECT;
+	// A neutral report first releases whatever was held when the link was lost.
+	state = SYNC_POSITION;
+	echoes = 0;
+	duration_count = 0;
+}
+
+// The phase a step plays, unless the options or an interruption choose it.
+static command (*StepPhase(Step_t s))(int) {
+	switch (s) {
+		case CONNECT_CONTROLLER:  return ConnectController;
+		case SYNC_CONTROLLER:     return SyncController;
+		case GO_TO_ALTERNA:       return GoToAlterna;
+		case OPEN_OPTION:         return OpenOption;
+		case JUMP_TO_STAGE:       return JumpToStage;
+		case ENTER_STAGE:         return EnterStage;
+		case CLEAR_STAGE:         return ClearStage;
+		case BACK_TO_SPLATSVILLE: return BackToSplatsville;
+		default:                  return NULL;
+	}
+}
+
+// The first command of the step that follows the current one at its END,
+// where the route alone decides it; otherwise NOTHING.
+static command Upcoming(Step_t* next) {
+	command none = { NOTHING, 0, ECHOES };
+
+	switch (step) {
+		case CLEAR_STAGE:
+			// clear_count counts this clear once its END is fetched.
+			*next = (SchedulePlan.clears == SCHEDULE_FOREVER || clear_count + 1 < SchedulePlan.clears) ? ENTER_STAGE : LUNCH_DRONE;
+			break;
+
+		case CONNECT_CONTROLLER:
+		case SYNC_CONTROLLER:
+		case GO_TO_ALTERNA:
+		case JUMP_TO_STAGE:
+		case ENTER_STAGE:
+			*next = step + 1;
+			break;
+
+		default:
+			// The options, the drone runs or an interruption decide.
+			return none;
+	}
+
+	command (*phase)(int) = StepPhase(*next);
+	return phase ? phase(0) : none;
+}
+
+// In the window of a wait that ends its phase (route.txt: accepts), play the
+// first input of the next step already, when the game takes it early. The
+// input is held from the start of the window to the END without a break,
+// and the polls it was sent for count towards it once the next step starts;
+// that step still plays its last frame itself.
+static void PackEarly(USB_JoystickReport_Input_t* const ReportData) {
+	command (*phase)(int) = StepPhase(step);
+	Step_t next_step = step;
+
+	// A cartridge loads too unevenly for the window to be counted on
+	// (sim/robust.py --soft-type), so there the next step waits for the END.
+	if (SOFT_TYPE || phase == NULL || phase(bufindex + 1).button != END) {
+		return;
+	}
+
+	command next = Upcoming(&next_step);
+	uint16_t left = tmp.duration - duration_count + 1; // frames of the wait left, this one included
+	uint16_t polls = packed_polls + left * (1 + tmp.echoes);
+	if (left > Accepts(phase, next.button) || polls / (1 + next.echoes) >= next.duration) {
+		return;
+	}
+
+	ApplyButton(ReportData, next.button);
+	packed = next;
+	packed_step = next_step;
+	packed_polls += 1 + tmp.echoes;
+}
+
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 
@@ -186,7 +1014,35 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 	ReportData->RY = STICK_CENTER;
 	ReportData->HAT = HAT_CENTER;
 
-	// Repeat ECHOES times the last report
+	// A long silence from the host is an anomaly worth keeping.
+	uint16_t gap = BlackBoxPoll();
+	if (gap >= BLACKBOX_GAP_MS) {
+		RecordState(BLACKBOX_GAP, gap);
+	}
+	// After an interruption the route resumes instead of running on with stale timing.
+	if (gap >= RESUME_GAP_MS) {
+		link_lost |= LINK_GAP;
+	}
+	if (link_lost) {
+		uint8_t cause = link_lost;
+		link_lost = 0;
+		// Nothing has reached the game before CONNECT_CONTROLLER is over, and nothing is left after DONE.
+		if (state != DONE && step != CONNECT_CONTROLLER) {
+			Resume(cause);
+		}
+	}
+	// The ring is saved once its records of the gap (and the resume) are in.
+	if (gap >= BLACKBOX_GAP_MS) {
+		BlackBoxSave(BLACKBOX_GAP);
+	}
+	// Every change of state or step is recorded before its first frame is made.
+	if (echoes == 0 && (state != recorded_state || step != recorded_step)) {
+		RecordState(BLACKBOX_STEP, gap);
+		recorded_state = state;
+		recorded_step = step;
+	}
+
+	// Repeat the last report as many times as its phase asks
 	if (echoes > 0)
 	{
 		memcpy(ReportData, &last_report, sizeof(USB_JoystickReport_Input_t));
@@ -194,6 +1050,9 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 		return;
 	}
 
+	// The echo count of the report made below
+	uint8_t echo = ECHOES;
+
 	// States and moves management
 	switch (state)
 	{
@@ -209,13 +1068,25 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			ReportData->HAT = HAT_CENTER;
 			
 			state = BREATHE;
+			if (idle_frames < UINT8_MAX) {
+				idle_frames++;
+			}
 			break;
 		
 		case BREATHE:
 			state = PROCESS;
+			if (idle_frames < UINT8_MAX) {
+				idle_frames++;
+			}
 			break;
 		
 		case PROCESS:
+
+			// デバッグ用です。
+			// 1-8ヤカン上でマイコンを接続すると、コントローラーの登録後に感度設定などをスキップして周回を始めます。
+			if (START_AT_KETTLE && step == GO_TO_ALTERNA && bufindex == 0) {
+				SeekPhase(ENTER_STAGE);
+			}
 			
 			switch (step) {
 
@@ -233,39 +1104,35 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 				
 				case OPEN_OPTION:
 					tmp = OpenOption(bufindex);
-
-					if (tmp.button == END) {
-						cnt++;
-					}
-
 					break;
 				
 				case TURN_OFF_GYRO:
-					if (GYRO_SETTING) {
+					// ジャイロ操作が現在 ON の場合のみ切り替える
+					if (gyro_on) {
 						tmp = TurnOffGyro(bufindex);
+						if (tmp.button == END) {
+							gyro_on = 0;
+						}
+					} else {
+						tmp = Skip(bufindex);
 					}
 					
 					break;
 				
 				case SET_SENSITIVITY:
+				case RESET_SENSITIVITY:
+					// 記録している現在の感度から、このステップで必要な感度まで十字キーで移動する
 					flag = 0;
-					if (sensitivity_set != sensitivity_val) {
-						if (SENSITIVITY * 2 > sensitivity_set) {
-							mode = 1;
-							tmp = SetSensitivity(bufindex, mode); // 十字左連打
-						}
-						if (SENSITIVITY * 2 < sensitivity_set) {
-							mode = 0;
-							tmp = SetSensitivity(bufindex, mode); // 十字右連打
-						}
-						if (tmp.button == END && mode == 1) {
-							sensitivity_val--;
-						}
-						if (tmp.button == END && mode == 0) {
-							sensitivity_val++;
+					sensitivity_target = (step == SET_SENSITIVITY) ? sensitivity_set : SENSITIVITY * 2;
+					if (sensitivity_val != sensitivity_target) {
+						mode = (sensitivity_val > sensitivity_target); // 1 なら十字左連打、0 なら十字右連打
+						tmp = mode ? SetSensitivityLeft(bufindex) : SetSensitivityRight(bufindex);
+						if (tmp.button == END) {
+							sensitivity_val += mode ? -1 : 1;
 						}
 					} else {
 						flag = 1;
+						tmp = Skip(bufindex);
 					}
 
 					break;
@@ -288,35 +1155,18 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					break;
 				
 				case LUNCH_DRONE:
-					tmp = LunchDrone(bufindex);
-					break;
-				
-				case RESET_SENSITIVITY:
-					flag = 0;
-					if (sensitivity_val != SENSITIVITY * 2) {
-						if (SENSITIVITY * 2 > sensitivity_set) {
-							mode = 0;
-							tmp = SetSensitivity(bufindex, mode); // 十字右連打
-						}
-						if (SENSITIVITY * 2 < sensitivity_set) {
-							mode = 1;
-							tmp = SetSensitivity(bufindex, mode); // 十字左連打
-						}
-						if (tmp.button == END && mode == 0) {
-							sensitivity_val++;
-						}
-						if (tmp.button == END && mode == 1) {
-							sensitivity_val--;
-						}
-					} else {
-						flag = 1;
-					}
-
+					tmp = MergeTracks(ReportData, LunchDrone, duration_count);
 					break;
 				
 				case RESET_GYRO_SETTING:
-					if (GYRO_SETTING) {
+					// ジャイロ操作が元の設定と異なる場合のみ切り替える
+					if (gyro_on != GYRO_SETTING) {
 						tmp = ResetGyroSetting(bufindex);
+						if (tmp.button == END) {
+							gyro_on = GYRO_SETTING;
+						}
+					} else {
+						tmp = Skip(bufindex);
 					}
 					
 					break;
@@ -326,164 +1176,45 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 
 					if (tmp.button == END) {
 						state = DONE;
+						#ifdef ALERT_WHEN_DONE
+						TaskStart(TASK_ALERT, AlertTask, 250);
+						#endif
 					}
 
 					break;
-				
-			}
 
-			switch (tmp.button) {
-				
-				case L_UP:
-					ReportData->LY = STICK_MIN;
-					break;
-				
-				case L_DOWN:
-					ReportData->LY = STICK_MAX;
-					break;
-				
-				case L_LEFT:
-					ReportData->LX = STICK_MIN;
-					break;
-				
-				case L_RIGHT:
-					ReportData->LX = STICK_MAX;
-					break;
-				
-				case R_UP:
-					if (!REVERSE_UD) {
-						ReportData->RY = STICK_MIN;
-					} else {
-						ReportData->RY = STICK_MAX;
-					}
-					break;
-				
-				case R_DOWN:
-					if (!REVERSE_UD) {
-						ReportData->RY = STICK_MAX;
-					} else {
-						ReportData->RY = STICK_MIN;
-					}
-					break;
-				
-				case R_LEFT:
-					if (!REVERSE_LR) {
-						ReportData->RX = STICK_MIN;
-					} else {
-						ReportData->RX = STICK_MAX;
-					}
-					break;
-				
-				case R_RIGHT:
-					if (!REVERSE_LR) {
-						ReportData->RX = STICK_MAX;
-					} else {
-						ReportData->RX = STICK_MIN;
-					}
-					break;
-				
-				case TOP:
-					ReportData->HAT = HAT_TOP;
-					break;
-				
-				case BOTTOM:
-					ReportData->HAT = HAT_BOTTOM;
-					break;
-				
-				case LEFT:
-					ReportData->HAT = HAT_LEFT;
-					break;
-				
-				case RIGHT:
-					ReportData->HAT = HAT_RIGHT;
-					break;
-				
-				case A:
-					ReportData->Button |= SWITCH_A;
-					break;
-				
-				case B:
-					ReportData->Button |= SWITCH_B;
-					break;
-				
-				case X:
-					ReportData->Button |= SWITCH_X;
-					break;
-				
-				case Y:
-					ReportData->Button |= SWITCH_Y;
-					break;
-				
-				case L:
-					ReportData->Button |= SWITCH_L;
-					break;
-				
-				case R:
-					ReportData->Button |= SWITCH_R;
-					break;
-				
-				case ZL:
-					ReportData->Button |= SWITCH_ZL;
-					break;
-				
-				case ZR:
-					ReportData->Button |= SWITCH_ZR;
-					break;
-				
-				case MINUS:
-					ReportData->Button |= SWITCH_MINUS;
-					break;
-				
-				case PLUS:
-					ReportData->Button |= SWITCH_PLUS;
-					break;
-				
-				case TRIGGERS:
-					ReportData->Button |= SWITCH_L | SWITCH_R;
-					break;
-				
-				case AIM_SHOT:
-					ReportData->Button |= SWITCH_ZR;
-					if (!REVERSE_UD) {
-						ReportData->RY = STICK_CENTER - 36;
+				case RECONNECT:
+					// Only the parts the interruption needs, in order.
+					if (reconnect_parts & RECONNECT_SYNC) {
+						tmp = SyncController(bufindex);
+					} else if (reconnect_parts & RECONNECT_MENUS) {
+						tmp = CloseMenus(bufindex);
 					} else {
-						ReportData->RY = STICK_CENTER + 36;
+						tmp = QuitStage(bufindex);
 					}
-					if (!REVERSE_LR) {
-						ReportData->RX = STICK_CENTER - 22;
-					} else {
-						ReportData->RX = STICK_CENTER + 22;
-					}					
-					break;
 
-				case AIM_MAP:
-					ReportData->LX = STICK_MIN;
-					ReportData->LY = 192;
 					break;
 				
-				case JUMP:
-					ReportData->Button |= SWITCH_B;
-					ReportData->LY = STICK_MIN;
-					break;
+			}
+
+			// An END only passes to the next step, unless SOFT_TYPE holds it for a load.
+			if (tmp.button != END || duration_count < tmp.duration) {
+				idle_frames = 0;
+			} else if (idle_frames < UINT8_MAX) {
+				idle_frames++;
+			}
 
+			switch (tmp.button) {
+				
 				case END:
-					/* 
-					if (step == SYNC_CONTROLLER) {
-						bufindex = 0;
-						duration_count = 0;
-						step = ENTER_STAGE;
-					}
-					// デバッグ用です。
-					// 1-8ヤカン上でマイコンを接続すると、感度設定などをスキップして周回を始めます。
-					*/
-					
-					if (INFINITE_LOOP_MODE && step == CLEAR_STAGE) {
+					// The scheduler's plan decides how many clears come before each drone run.
+					if (step == CLEAR_STAGE && SchedulePlan.clears == SCHEDULE_FOREVER) {
 						step = ENTER_STAGE;
 						bufindex = 0;
 						duration_count = 0;
 						clear_count = 0;
 					}					
-					else if (step == CLEAR_STAGE && (0 < clear_count && clear_count < 4)) {
+					else if (step == CLEAR_STAGE && (0 < clear_count && clear_count < SchedulePlan.clears)) {
 						step = ENTER_STAGE;
 						bufindex = 0;
 						duration_count = 0;
@@ -492,8 +1223,10 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 						step = OPEN_OPTION;
 						bufindex = 0;
 						duration_count = 0;
+						clear_count = 0;
+						drone_count++;
 					}
-					else if (step == OPEN_OPTION && cnt == 2) {
+					else if (step == OPEN_OPTION && drone_count >= SchedulePlan.drone_runs) {
 						step = RESET_SENSITIVITY;
 						bufindex = 0;
 						duration_count = 0;
@@ -506,6 +1239,20 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 						bufindex = 0;
 						duration_count = 0;
 					}
+					else if (step == RECONNECT) {
+						// The part is done; after the last one, the route resumes.
+						reconnect_parts &= reconnect_parts - 1;
+						if (reconnect_parts == 0) {
+							step = resume_step;
+							bufindex = resume_bufindex;
+						} else {
+							bufindex = 0;
+						}
+						duration_count = 0;
+					}
+					else if (step == BACK_TO_SPLATSVILLE) {
+						// DONE: the engine stays on the last step.
+					}
 					else {
 						if (SOFT_TYPE && (step == GO_TO_ALTERNA || step == ENTER_STAGE) && duration_count < tmp.duration) {
 							break;
@@ -516,17 +1263,28 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 						}
 					}
 
+					// The input played early stays held. Its frames so far only shorten
+					// the step's own hold with EARLY_HOLD_CREDIT: the game counts the
+					// hold from the landing, which may come after the window opened.
+					if (packed_polls) {
+						ApplyButton(ReportData, packed.button);
+						if (EARLY_HOLD_CREDIT && step == packed_step && bufindex == 0) {
+							duration_count += packed_polls / (1 + packed.echoes);
+						}
+						packed_polls = 0;
+					}
+
 					break;
 				
 				default:
-					ReportData->LX = STICK_CENTER;
-					ReportData->LY = STICK_CENTER;
-					ReportData->RX = STICK_CENTER;
-					ReportData->RY = STICK_CENTER;
-					ReportData->HAT = HAT_CENTER;
+					ApplyButton(ReportData, tmp.button);
+					if (tmp.button == NOTHING) {
+						PackEarly(ReportData);
+					}
 					break;
 			}
 
+			echo = tmp.echoes;
 			duration_count++;
 			
 			if (tmp.button != END && duration_count > tmp.duration) {
@@ -537,18 +1295,14 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			break;
 
 		case DONE:
-			#ifdef ALERT_WHEN_DONE
-			portsval = ~portsval;
-			PORTD = portsval; //flash LED(s) and sound buzzer if attached
-			PORTB = portsval;
-			_delay_ms(250);
-			#endif
+			// The alert, if any, is flashed by TASK_ALERT; we must not wait here in the IN path.
 			return;
 	}
 
 
 	// Prepare to echo this report
 	memcpy(&last_report, ReportData, sizeof(USB_JoystickReport_Input_t));
-	echoes = ECHOES;
+	echoes = echo;
+	KeepRecoveryPoint();
 
 }
\ No newline at end of file
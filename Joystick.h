@@ -53,6 +53,14 @@
 #include "Descriptors.h"
 #include "Config.h"
 #include "Step.h"
+#include "Memory.h"
+#include "Timer.h"
+#include "BlackBox.h"
+#include "Schedule.h"
+#include "Macro.h"
+#include "Task.h"
+#include "ProController.h"
+#include "SeekIndex.h"
 
 // Type Defines
 // Enumeration for joystick buttons.
@@ -109,6 +117,53 @@ typedef struct {
 	uint8_t  RY;     // Right Stick Y
 } USB_JoystickReport_Output_t;
 
+// States of the report engine.
+typedef enum {
+	SYNC_POSITION,
+	BREATHE,
+	PROCESS,
+	DONE
+} State_t;
+
+typedef enum {
+	CONNECT_CONTROLLER,
+	SYNC_CONTROLLER,
+	GO_TO_ALTERNA,
+	OPEN_OPTION,
+	TURN_OFF_GYRO,
+	SET_SENSITIVITY,
+	JUMP_TO_STAGE,
+	ENTER_STAGE,
+	CLEAR_STAGE,
+	LUNCH_DRONE,
+	RESET_SENSITIVITY,
+	RESET_GYRO_SETTING,
+	BACK_TO_SPLATSVILLE,
+	RECONNECT, // after an interruption: register again, close menus, then resume_step
+} Step_t;
+
+// Why the engine was interrupted (bits of link_lost).
+#define LINK_SUSPEND     0x01 // the console slept (USB suspend)
+#define LINK_DISCONNECT  0x02 // the cable was unplugged or the dock lost power
+#define LINK_RECONFIGURE 0x04 // the host enumerated the controller again
+#define LINK_GAP         0x08 // the host stopped polling for RESUME_GAP_MS or more
+#define LINK_RESET       0x10 // the watchdog or a brown-out reset the controller mid-route
+extern volatile uint8_t link_lost;
+
+// A poll gap this long (ms) leaves the route's timing stale even without a USB event.
+#ifndef RESUME_GAP_MS
+#define RESUME_GAP_MS 1000
+#endif
+
+// The watchdog resets the controller when the main loop stops making progress this long.
+#ifndef WATCHDOG_TIMEOUT
+#define WATCHDOG_TIMEOUT WDTO_500MS
+#endif
+// A route that resets this many times before RECONNECT is over starts again from the beginning.
+#ifndef RECOVERY_MAX_RESETS
+#define RECOVERY_MAX_RESETS 3
+#endif
+
 // Function Prototypes
 // Setup all necessary hardware, including USB initialization.
 void SetupHardware(void);
@@ -117,9 +172,27 @@ void HID_Task(void);
 // USB device event handlers.
 void EVENT_USB_Device_Connect(void);
 void EVENT_USB_Device_Disconnect(void);
+void EVENT_USB_Device_Suspend(void);
 void EVENT_USB_Device_ConfigurationChanged(void);
 void EVENT_USB_Device_ControlRequest(void);
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData);
+// Apply a single command's input to a report.
+void ApplyButton(USB_JoystickReport_Input_t* const ReportData, Buttons_t button);
+// Merge the active tracks of a timeline phase into a report.
+command MergeTracks(USB_JoystickReport_Input_t* const ReportData, command (*timeline)(int, int), int frame);
+// Jump the engine to an absolute frame of the route, or to the start of a step.
+bool SeekFrame(uint32_t frame);
+bool SeekPhase(Step_t phase);
+// Record the engine state in the black box.
+void RecordState(uint8_t event, uint16_t gap);
+// Pick the route up where it was when the watchdog or a brown-out reset the controller.
+void Recover(uint8_t reset_cause);
+// Convert a report to the input of a Pro Controller report.
+void ProInput(const USB_JoystickReport_Input_t* const ReportData, pro_input* input);
+#ifdef ALERT_WHEN_DONE
+// Flash the alert LEDs and buzzer (TASK_ALERT).
+void AlertTask(void);
+#endif
 
 #endif
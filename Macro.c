@@ -0,0 +1,188 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include <string.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+#include "Macro.h"
+
+#define ENTRY_BUTTON ((1 << MACRO_BUTTON_BITS) - 1)
+#define RECORD_SIZE  3 // 記録の先頭 {table, echo, count}
+
+uint16_t MacroTables[TABLE_COUNT];
+
+static uint8_t MacroSaved[MACRO_SIZE] EEMEM;
+/* 起動時に検査を通したプログラムの写し */
+/* MacroAt は毎フレーム読むので、EEPROM の書き込み中（ブラックボックスの保存など）にその完了 (3.4 ms) を待たないよう SRAM から読む */
+static uint8_t program[MACRO_SIZE];
+static uint8_t state = MACRO_NONE;
+static uint16_t written = 0;
+
+/* MACRO_WRITE で受け取り、EEPROM に書き込むデータ */
+static uint8_t chunk[MACRO_CHUNK];
+static uint16_t chunk_offset;
+static uint8_t chunk_length = 0;
+static uint8_t write_index = 0; // 次に EEPROM に書くバイト（chunk_length なら書き込み中でない）
+
+static uint16_t ReadWord(uint16_t offset) {
+	return eeprom_read_byte(&MacroSaved[offset]) | (uint16_t)eeprom_read_byte(&MacroSaved[offset + 1]) << 8;
+}
+
+/* EEPROM のプログラムを検査する（magic は見ない） */
+/* tables が NULL でなければ、テーブルごとの記録の位置を入れる */
+static bool Check(uint16_t* tables) {
+	macro_header header;
+	eeprom_read_block(&header, MacroSaved, sizeof(header));
+
+	if (header.version != MACRO_VERSION || header.route != ROUTE_SIGNATURE || header.length > MACRO_SIZE - sizeof(header)) {
+		return false;
+	}
+
+	uint16_t end = sizeof(header) + header.length;
+	uint16_t crc = 0xFFFF;
+	for (uint16_t at = sizeof(header); at < end; at++) {
+		crc = _crc_ccitt_update(crc, eeprom_read_byte(&MacroSaved[at]));
+	}
+	if (crc != header.crc) {
+		return false;
+	}
+
+	// 記録がちょうど length バイトに収まり、どのテーブルも END で終わること
+	uint16_t at = sizeof(header);
+	for (uint8_t n = 0; n < header.tables; n++) {
+		if (at + RECORD_SIZE > end) {
+			return false;
+		}
+		uint8_t table = eeprom_read_byte(&MacroSaved[at]);
+		uint8_t count = eeprom_read_byte(&MacroSaved[at + 2]);
+		uint16_t next = at + RECORD_SIZE + 2 * count;
+		if (table >= TABLE_COUNT || count == 0 || next > end || (ReadWord(next - 2) & ENTRY_BUTTON) != END) {
+			return false;
+		}
+		if (tables) {
+			tables[table] = at;
+		}
+		at = next;
+	}
+	return at == end;
+}
+
+void MacroInit(void) {
+	macro_header header;
+	eeprom_read_block(&header, MacroSaved, sizeof(header));
+
+	memset(MacroTables, 0, sizeof(MacroTables));
+	chunk_length = write_index = 0;
+	written = 0;
+
+	// 未書き込み (0xFF) や書き込みの途中で止まったプログラムには magic が無い
+	if (header.magic != MACRO_MAGIC) {
+		state = MACRO_NONE;
+	} else if (Check(MacroTables)) {
+		eeprom_read_block(program, MacroSaved, sizeof(header) + header.length);
+		state = MACRO_ACTIVE;
+	} else {
+		// 別のルートのファームウェアに書き換えた後など
+		memset(MacroTables, 0, sizeof(MacroTables));
+		state = MACRO_INVALID;
+	}
+}
+
+command MacroAt(Table_t table, int index) {
+	const uint8_t* record = &program[MacroTables[table]];
+	const uint16_t* entries = (const uint16_t*)&record[RECORD_SIZE];
+
+	// STEP_AT はフラッシュのテーブルと同じくアドレスを計算するだけで、エントリは 1 バイトずつ読む（境界に揃っていない）
+	const uint8_t* address = (const uint8_t*)STEP_AT(entries, record[2], index);
+	uint16_t entry = address[0] | (uint16_t)address[1] << 8;
+	command cmd = { entry & ENTRY_BUTTON, entry >> MACRO_BUTTON_BITS, record[1] };
+	return cmd;
+}
+
+bool MacroWritable(uint16_t offset, uint16_t length) {
+	return write_index == chunk_length && length > 0 && length <= MACRO_CHUNK && offset <= MACRO_SIZE - length;
+}
+
+void MacroWrite(uint16_t offset, const uint8_t* data, uint8_t length) {
+	// 書き換わっていく EEPROM のテーブルは、書き始めたらもう読まない
+	if (state != MACRO_WRITING) {
+		memset(MacroTables, 0, sizeof(MacroTables));
+		state = MACRO_WRITING;
+		written = 0;
+	}
+
+	// magic は MacroCommit() の検査を通ってから書く（途中で電源が切れたプログラムは次の起動で使われない）
+	memcpy(chunk, data, length);
+	for (uint8_t i = 0; i < length && offset + i < sizeof(uint16_t); i++) {
+		chunk[i] = 0xFF;
+	}
+	chunk_offset = offset;
+	chunk_length = length;
+	write_index = 0;
+	if (offset + length > written) {
+		written = offset + length;
+	}
+}
+
+/* magic だけを書き込む */
+static void WriteMagic(uint16_t magic) {
+	chunk[0] = magic & 0xFF;
+	chunk[1] = magic >> 8;
+	chunk_offset = 0;
+	chunk_length = sizeof(uint16_t);
+	write_index = 0;
+}
+
+bool MacroCommit(void) {
+	if (write_index != chunk_length) {
+		return false;
+	}
+
+	if (Check(NULL)) {
+		WriteMagic(MACRO_MAGIC);
+		state = MACRO_READY;
+	} else {
+		state = MACRO_INVALID;
+	}
+	return true;
+}
+
+bool MacroErase(void) {
+	if (write_index != chunk_length) {
+		return false;
+	}
+
+	// 使っているテーブルは EEPROM に残るので、次の起動まではそのまま使う
+	WriteMagic(0xFFFF);
+	state = MACRO_NONE;
+	return true;
+}
+
+macro_status MacroStatus(void) {
+	macro_status status = {
+		.state   = state,
+		.busy    = (write_index != chunk_length),
+		.route   = ROUTE_SIGNATURE,
+		.size    = MACRO_SIZE,
+		.written = written,
+		.version = MACRO_VERSION,
+	};
+
+	for (uint8_t i = 0; i < TABLE_COUNT; i++) {
+		status.tables += MacroHas(i);
+	}
+	return status;
+}
+
+void MacroTask(void) {
+	if (write_index == chunk_length || !eeprom_is_ready()) {
+		return;
+	}
+
+	// 書き込みの完了を待たずに戻り、次の呼び出しで続きを書く
+	eeprom_update_byte(&MacroSaved[chunk_offset + write_index], chunk[write_index]);
+	write_index++;
+}
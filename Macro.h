@@ -0,0 +1,97 @@
+/* Header file for Macro.c */
+
+/* ------------------------------------------------------------ */
+/* USB のベンダーリクエストで EEPROM に書き込むプログラム       */
+/* プログラムには route.txt のフェーズのテーブルを入れられ、     */
+/* 起動時に検査を通ったテーブルはフラッシュのテーブルの代わりに */
+/* 使われる（route2c.py -p で作り、gadget/reader -u で送る）    */
+/* ------------------------------------------------------------ */
+
+#ifndef _MACRO_H_
+#define _MACRO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "Step.h"
+
+#define MACRO_MAGIC   0x4D50 // プログラムが有効なときの macro_header.magic
+#define MACRO_VERSION 1      // プログラムの並びの版
+#define MACRO_REQUEST 0x04   // ベンダーリクエストの bRequest
+                             // bmRequestType 0xC0 で macro_status を返し、0x40 で wIndex の操作を行う
+#ifndef MACRO_SIZE
+#define MACRO_SIZE    384    // プログラムに使う EEPROM のバイト数（ヘッダーを含む）
+#endif
+#define MACRO_CHUNK   32     // MACRO_WRITE 1回で書き込める最大のバイト数
+#define MACRO_BUTTON_BITS 5  // エントリの下位ビットが Buttons_t、残りのビットが duration（route2c.py の BUTTON_BITS）
+
+/* 0x40 のリクエストの操作 (wIndex) */
+enum {
+	MACRO_WRITE,  // データを wValue の位置に書き込む（magic は MACRO_COMMIT まで書かない）
+	MACRO_COMMIT, // データなし: 書き込んだプログラムを検査し、正しければ magic を書く（次の起動から使われる）
+	MACRO_ERASE,  // データなし: プログラムを消す（次の起動からフラッシュのテーブルに戻る）
+};
+
+/* プログラムの状態 */
+typedef enum {
+	MACRO_NONE,    // プログラムが無い（消したか、書いたことがない）
+	MACRO_ACTIVE,  // 起動時に検査を通り、テーブルを使っている
+	MACRO_INVALID, // 版・ルート・CRC・並びのどれかが合わず、使っていない
+	MACRO_WRITING, // 書き込み中（書き始めてから次の起動まで、フラッシュのテーブルを使う）
+	MACRO_READY,   // MACRO_COMMIT の検査を通った（次の起動から使われる）
+} macro_state;
+
+/* プログラムの先頭（EEPROM とファイルでは、この並びのリトルエンディアン） */
+/* 続く length バイトは、テーブルごとの記録 {uint8_t table, echo, count} と */
+/* count 個の uint16_t のエントリ (button | duration << MACRO_BUTTON_BITS、最後は END) */
+typedef struct {
+	uint16_t magic;   // MACRO_MAGIC
+	uint16_t route;   // ROUTE_SIGNATURE（テーブルの番号と Buttons_t の並び）
+	uint16_t length;  // ヘッダーに続く記録のバイト数
+	uint16_t crc;     // 記録の CRC-16 (CCITT, 初期値 0xFFFF)
+	uint8_t  version; // MACRO_VERSION
+	uint8_t  tables;  // 記録の数
+} macro_header;
+
+/* MACRO_REQUEST の返答（USB ではこの並びのリトルエンディアンで返す） */
+typedef struct {
+	uint8_t  state;   // macro_state
+	uint8_t  busy;    // EEPROM に書き込み中なら 1（次の MACRO_WRITE は受け付けない）
+	uint16_t route;   // このファームウェアの ROUTE_SIGNATURE
+	uint16_t size;    // MACRO_SIZE
+	uint16_t written; // 書き込み中のプログラムで、書き込まれた最後のバイトの次の位置
+	uint8_t  version; // MACRO_VERSION
+	uint8_t  tables;  // 使っているテーブルの数
+} macro_status;
+
+extern uint16_t MacroTables[TABLE_COUNT]; // テーブルごとの記録のプログラム上の位置（0 ならフラッシュのテーブル）
+
+/* 起動時に EEPROM のプログラムを検査し、使うテーブルを決める */
+void MacroInit(void);
+
+/* プログラムにテーブルがあるか */
+static inline bool MacroHas(Table_t table) {
+	return MacroTables[table] != 0;
+}
+
+/* プログラムのテーブルの index 番目のコマンド */
+command MacroAt(Table_t table, int index);
+
+/* MACRO_WRITE を受け付けられるか（前の書き込みが終わっていて、範囲が MACRO_SIZE と MACRO_CHUNK に収まる） */
+bool MacroWritable(uint16_t offset, uint16_t length);
+
+/* 受け取ったデータの EEPROM への書き込みを始める（書き始めたらフラッシュのテーブルに戻る） */
+void MacroWrite(uint16_t offset, const uint8_t* data, uint8_t length);
+
+/* MACRO_COMMIT と MACRO_ERASE（書き込み中なら何もせず false を返す） */
+/* 検査の結果は macro_status.state で返す */
+bool MacroCommit(void);
+bool MacroErase(void);
+
+/* MACRO_REQUEST の返答 */
+macro_status MacroStatus(void);
+
+/* メインループで呼び、EEPROM の準備ができていれば 1 バイトずつ書き込みを進める */
+void MacroTask(void);
+
+#endif
@@ -0,0 +1,82 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include "Memory.h"
+
+#ifdef __AVR__
+
+#include <avr/io.h>
+
+/* avr-libc のリンカスクリプトが定義するセクションの境界 */
+extern uint8_t __data_start, __data_end, __bss_start, __heap_start;
+
+void MemoryPaint(void) {
+	uint8_t* p = &__heap_start;
+
+	// SP より下（アドレスの小さい方）はまだ使われていない
+	while (p < (uint8_t*)SP) {
+		*p++ = MEMORY_PAINT;
+	}
+}
+
+memory_usage MemoryUsage(void) {
+	memory_usage usage;
+	uint8_t* p = &__heap_start;
+
+	// 塗りが残っている所の上端が、スタックが最も深くなった位置
+	// （スタックにたまたま MEMORY_PAINT が書かれていると数バイト浅く見える）
+	while (p <= (uint8_t*)RAMEND && *p == MEMORY_PAINT) {
+		p++;
+	}
+
+	usage.ram = RAMEND - RAMSTART + 1;
+	usage.data = &__data_end - &__data_start;
+	usage.bss = &__heap_start - &__bss_start;
+	usage.stack = RAMEND + 1 - (uint16_t)p;
+	usage.free = p - &__heap_start;
+	return usage;
+}
+
+#else
+
+/* ホスト (sim/, gadget/) ではセクションの大きさは測れないので 0 とし、 */
+/* 呼び出し元の下の MEMORY_HOST_WINDOW バイトを塗ってスタックだけを測る */
+#define MEMORY_HOST_WINDOW 16384
+
+#include <stddef.h>
+
+static const volatile uint8_t* paint_low;
+static const volatile uint8_t* paint_high;
+
+void __attribute__((noinline)) MemoryPaint(void) {
+	volatile uint8_t window[MEMORY_HOST_WINDOW];
+
+	for (size_t i = 0; i < sizeof(window); i++) {
+		window[i] = MEMORY_PAINT;
+	}
+	// window の位置だけを覚えておく（戻った後の中身は、この後の呼び出しが上書きする）
+	uintptr_t low = (uintptr_t)window;
+	__asm__("" : "+r"(low));
+	paint_low = (const volatile uint8_t*)low;
+	paint_high = paint_low + sizeof(window);
+}
+
+memory_usage MemoryUsage(void) {
+	memory_usage usage = { 0, 0, 0, 0, 0 };
+	const volatile uint8_t* p = paint_low;
+
+	if (p == NULL) {
+		return usage;
+	}
+	while (p < paint_high && *p == MEMORY_PAINT) {
+		p++;
+	}
+
+	usage.stack = paint_high - p;
+	usage.free = p - paint_low;
+	return usage;
+}
+
+#endif
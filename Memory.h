@@ -0,0 +1,32 @@
+/* Header file for Memory.c */
+
+/* ------------------------------------------------------------ */
+/* SRAM の使用量（セクションごと）とスタックの最大の深さを測る   */
+/* 起動時に未使用の領域を塗っておき、塗りが残っている所を調べる */
+/* ------------------------------------------------------------ */
+
+#ifndef _MEMORY_H_
+#define _MEMORY_H_
+
+#include <stdint.h>
+
+#define MEMORY_PAINT   0xC5 // 起動時に未使用の領域を塗る値
+#define MEMORY_REQUEST 0x01 // 使用量を返すベンダーリクエスト (bmRequestType 0xC0) の bRequest
+
+/* SRAM の使用量（バイト数、USB ではこの並びのリトルエンディアンで返す） */
+typedef struct {
+	uint16_t ram;   // SRAM の大きさ
+	uint16_t data;  // .data（初期値のあるグローバル変数）
+	uint16_t bss;   // .bss と .noinit（初期値のないグローバル変数）
+	uint16_t stack; // 起動してから最も深くなったときのスタック
+	uint16_t free;  // .bss の後ろからスタックの最深部までの、一度も使われていない領域
+} memory_usage;
+
+/* .bss の後ろから現在のスタックの位置までを MEMORY_PAINT で塗る */
+/* SetupHardware() の最初に呼ぶ */
+void MemoryPaint(void);
+
+/* 塗りが残っている所を調べて、現在までの使用量を返す */
+memory_usage MemoryUsage(void);
+
+#endif
@@ -0,0 +1,265 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include <string.h>
+#include <avr/pgmspace.h>
+
+#include "ProController.h"
+
+/* 返答のバイトの位置 */
+#define REPLY_ACK     13
+#define REPLY_ID      14
+#define REPLY_DATA    15
+#define SPI_MAX_READ  0x1D // SPI の読み出しの最大の長さ
+
+/* ホストに見せる MAC アドレス（ローカルアドレス） */
+static const uint8_t Address[6] PROGMEM = { 0x02, 0x00, 0x5A, 0x30, 0x84, 0x20 };
+
+/* SPI フラッシュのうち、ホストが読みに来る領域（それ以外は 0xFF = 未設定） */
+typedef struct {
+	uint16_t address;
+	uint8_t  size;
+	const uint8_t* data;
+} spi_region;
+
+/* 0x6012: 種類 (Pro コントローラー)、0x601B: 色の設定あり */
+static const uint8_t SpiType[1] PROGMEM = { 0x03 };
+static const uint8_t SpiColorSet[1] PROGMEM = { 0x01 };
+/* 0x6020: 6 軸センサーの工場出荷時の校正（原点 0、標準の感度） */
+static const uint8_t SpiImuCalibration[24] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x34, 0x3B, 0x34, 0x3B, 0x34,
+};
+/* 0x603D: スティックの工場出荷時の校正（12 ビットの組を 3 バイトに詰める） */
+/* 左は 上側の幅・中央・下側の幅、右は 中央・下側の幅・上側の幅 の順 */
+#define PACK(x, y) ((x) & 0xFF), (((x) >> 8) | (((y) & 0x0F) << 4)), ((y) >> 4)
+static const uint8_t SpiStickCalibration[18] PROGMEM = {
+	PACK(PRO_STICK_RANGE, PRO_STICK_RANGE),
+	PACK(PRO_STICK_CENTER, PRO_STICK_CENTER),
+	PACK(PRO_STICK_RANGE, PRO_STICK_RANGE),
+	PACK(PRO_STICK_CENTER, PRO_STICK_CENTER),
+	PACK(PRO_STICK_RANGE, PRO_STICK_RANGE),
+	PACK(PRO_STICK_RANGE, PRO_STICK_RANGE),
+};
+/* 0x6050: 本体・ボタン・グリップの色 */
+static const uint8_t SpiColors[13] PROGMEM = {
+	0x32, 0x32, 0x32, 0xFF, 0xFF, 0xFF, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x01,
+};
+/* 0x6080: センサーの水平のずれと、スティックの不感帯などのパラメーター */
+static const uint8_t SpiStickParameters[24] PROGMEM = {
+	0x50, 0xFD, 0x00, 0x00, 0xC6, 0x0F,
+	0x0F, 0x30, 0x61, 0x96, 0x30, 0xF3, 0xD4, 0x14, 0x54, 0x41, 0x15, 0x54, 0xC7, 0x79, 0x9C, 0x33, 0x36, 0x63,
+};
+
+static const spi_region SpiRegions[] = {
+	{ 0x6012, sizeof(SpiType), SpiType },
+	{ 0x601B, sizeof(SpiColorSet), SpiColorSet },
+	{ 0x6020, sizeof(SpiImuCalibration), SpiImuCalibration },
+	{ 0x603D, sizeof(SpiStickCalibration), SpiStickCalibration },
+	{ 0x6050, sizeof(SpiColors), SpiColors },
+	{ 0x6080, sizeof(SpiStickParameters), SpiStickParameters },
+	{ 0x6098, sizeof(SpiStickParameters) - 6, SpiStickParameters + 6 }, // 右スティックも同じ
+};
+
+static uint8_t reply[PRO_REPORT_SIZE];
+static uint8_t reply_size = 0;
+static bool streaming = false;
+static uint8_t timer = 0;
+static uint8_t status[10]; // 0x21 に入れる直前の入力（時計の次のバイトから）
+
+static uint8_t ReadSpiByte(uint16_t address) {
+	for (uint8_t i = 0; i < sizeof(SpiRegions) / sizeof(SpiRegions[0]); i++) {
+		const spi_region* region = &SpiRegions[i];
+		if (address >= region->address && address < region->address + region->size) {
+			return pgm_read_byte(region->data + (address - region->address));
+		}
+	}
+	return 0xFF;
+}
+
+/* 0x21 の返答を用意し、データを書く位置を返す */
+static uint8_t* StartReply(uint8_t ack, uint8_t id) {
+	memset(reply, 0, sizeof(reply));
+	reply[0] = PRO_REPORT_REPLY;
+	reply[1] = timer++;
+	memcpy(&reply[2], status, sizeof(status));
+	reply[REPLY_ACK] = ack;
+	reply[REPLY_ID] = id;
+	reply_size = PRO_REPORT_SIZE;
+	return &reply[REPLY_DATA];
+}
+
+static void Subcommand(uint8_t id, const uint8_t* args, uint8_t length) {
+	uint8_t* data;
+
+	switch (id) {
+		case PRO_SUB_DEVICE_INFO:
+			data = StartReply(0x82, id);
+			data[0] = 0x03; // ファームウェア 3.72
+			data[1] = 0x48;
+			data[2] = 0x03; // Pro コントローラー
+			data[3] = 0x02;
+			for (uint8_t i = 0; i < 6; i++) {
+				data[4 + i] = pgm_read_byte(&Address[i]);
+			}
+			data[10] = 0x01;
+			data[11] = 0x01; // SPI の色を使う
+			break;
+
+		case PRO_SUB_SPI_READ: {
+			uint16_t address = args[0] | (args[1] << 8);
+			uint8_t size = args[4];
+			if (length < 5 || args[2] != 0 || args[3] != 0 || size > SPI_MAX_READ) {
+				size = 0;
+			}
+			data = StartReply(0x90, id);
+			memcpy(data, args, 4);
+			data[4] = size;
+			for (uint8_t i = 0; i < size; i++) {
+				data[5 + i] = ReadSpiByte(address + i);
+			}
+			break;
+		}
+
+		case PRO_SUB_TRIGGERS:
+			StartReply(0x83, id); // ボタンを押していた時間はすべて 0
+			break;
+
+		case PRO_SUB_PAIRING:
+			data = StartReply(0x81, id);
+			data[0] = 0x03;
+			break;
+
+		case PRO_SUB_MCU_CONFIG: {
+			// NFC/IR のマイコンは無いが、設定の完了を返す
+			static const uint8_t Mcu[] PROGMEM = { 0x01, 0x00, 0xFF, 0x00, 0x08, 0x00, 0x1B, 0x01 };
+			data = StartReply(0xA0, id);
+			memcpy_P(data, Mcu, sizeof(Mcu));
+			data[33] = 0xC8; // CRC (固定値)
+			break;
+		}
+
+		case PRO_SUB_VOLTAGE:
+			data = StartReply(0xD0, id);
+			data[0] = 0x83; // 1.667 V
+			data[1] = 0x06;
+			break;
+
+		default:
+			// 入力モード・ライト・IMU・振動などは受け付けるだけ
+			StartReply(0x80, id);
+			break;
+	}
+}
+
+void ProControllerOut(const uint8_t* data, uint8_t length) {
+	if (length < 2) {
+		return;
+	}
+
+	switch (data[0]) {
+		case PRO_OUT_USB:
+			switch (data[1]) {
+				case PRO_USB_STATUS:
+					memset(reply, 0, sizeof(reply));
+					reply[0] = PRO_REPORT_USB;
+					reply[1] = PRO_USB_STATUS;
+					reply[3] = 0x03; // Pro コントローラー
+					for (uint8_t i = 0; i < 6; i++) {
+						reply[4 + i] = pgm_read_byte(&Address[5 - i]);
+					}
+					reply_size = PRO_REPORT_SIZE;
+					break;
+				case PRO_USB_HANDSHAKE:
+				case PRO_USB_BAUDRATE:
+					memset(reply, 0, sizeof(reply));
+					reply[0] = PRO_REPORT_USB;
+					reply[1] = data[1];
+					reply_size = PRO_REPORT_SIZE;
+					break;
+				case PRO_USB_HID_ONLY:
+					streaming = true;
+					break;
+				case PRO_USB_BLUETOOTH:
+					streaming = false;
+					break;
+			}
+			break;
+
+		case PRO_OUT_SUBCOMMAND:
+			// 0x01, カウンター, 振動 8 バイト, サブコマンド, 引数
+			if (length >= 11) {
+				Subcommand(data[10], &data[11], length - 11);
+			}
+			break;
+
+		case PRO_OUT_RUMBLE:
+			// 振動は無視する
+			break;
+	}
+}
+
+uint8_t ProControllerReply(uint8_t* report) {
+	uint8_t size = reply_size;
+
+	if (size) {
+		memcpy(report, reply, size);
+		reply_size = 0;
+	}
+	return size;
+}
+
+bool ProControllerStreaming(void) {
+	return streaming;
+}
+
+static void PutStick(uint8_t* out, uint16_t x, uint16_t y) {
+	out[0] = x & 0xFF;
+	out[1] = (x >> 8) | ((y & 0x0F) << 4);
+	out[2] = y >> 4;
+}
+
+static void PutWord(uint8_t* out, int16_t value) {
+	out[0] = value & 0xFF;
+	out[1] = (uint16_t)value >> 8;
+}
+
+void ProControllerFull(const pro_input* input, uint8_t* report) {
+	memset(report, 0, PRO_REPORT_SIZE);
+	report[0] = PRO_REPORT_FULL;
+	report[1] = timer++;
+	report[2] = 0x91; // 電池は満タン、USB から給電
+	report[3] = input->right;
+	report[4] = input->shared;
+	report[5] = input->left;
+	PutStick(&report[6], input->lx, input->ly);
+	PutStick(&report[9], input->rx, input->ry);
+	report[12] = 0x00; // 振動の状態
+
+	// 5 ミリ秒ごとの 3 サンプル。水平に置いた状態で、角速度だけを入れる
+	for (uint8_t i = 0; i < 3; i++) {
+		uint8_t* sample = &report[13 + 12 * i];
+		PutWord(&sample[4], PRO_ACCEL_1G);
+		PutWord(&sample[8], input->pitch);
+		PutWord(&sample[10], input->yaw);
+	}
+
+	// 次のサブコマンドの返答にも同じ入力を入れる
+	memcpy(status, &report[2], sizeof(status));
+}
+
+void ProControllerReset(void) {
+	static const pro_input Idle = {
+		.lx = PRO_STICK_CENTER, .ly = PRO_STICK_CENTER,
+		.rx = PRO_STICK_CENTER, .ry = PRO_STICK_CENTER,
+	};
+	uint8_t report[PRO_REPORT_SIZE];
+
+	// 最初の 0x30 を送るまでの返答には、何も入力していない状態を入れる
+	ProControllerFull(&Idle, report);
+	timer = 0;
+	reply_size = 0;
+	streaming = false;
+}
@@ -0,0 +1,101 @@
+/* Header file for ProController.c */
+
+/* ------------------------------------------------------------ */
+/* Pro コントローラーとして接続するモード (PRO_CONTROLLER)      */
+/* USB のハンドシェイク・サブコマンドに答え、0x30 の入力レポート */
+/* （ボタン・12 ビットのスティック・IMU の 3 サンプル）を作る   */
+/* ------------------------------------------------------------ */
+
+#ifndef _PRO_CONTROLLER_H_
+#define _PRO_CONTROLLER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "Config.h"
+
+#define PRO_VENDOR_ID   0x057E
+#define PRO_PRODUCT_ID  0x2009
+#define PRO_REPORT_SIZE 64 // レポートの長さ（エンドポイントのサイズ）
+
+/* 入力レポートの種類（先頭のバイト） */
+#define PRO_REPORT_FULL     0x30 // 通常の入力
+#define PRO_REPORT_REPLY    0x21 // サブコマンドへの返答 + 入力
+#define PRO_REPORT_USB      0x81 // USB コマンドへの返答
+
+/* 出力レポートの種類 */
+#define PRO_OUT_SUBCOMMAND  0x01 // 振動 + サブコマンド
+#define PRO_OUT_RUMBLE      0x10 // 振動のみ
+#define PRO_OUT_USB         0x80 // USB コマンド
+
+/* USB コマンド (0x80 xx) */
+#define PRO_USB_STATUS      0x01
+#define PRO_USB_HANDSHAKE   0x02
+#define PRO_USB_BAUDRATE    0x03
+#define PRO_USB_HID_ONLY    0x04 // これ以降 0x30 を送り続ける
+#define PRO_USB_BLUETOOTH   0x05 // 0x30 の送信を止める
+
+/* サブコマンド */
+#define PRO_SUB_PAIRING     0x01
+#define PRO_SUB_DEVICE_INFO 0x02
+#define PRO_SUB_INPUT_MODE  0x03
+#define PRO_SUB_TRIGGERS    0x04
+#define PRO_SUB_SHIPMENT    0x08
+#define PRO_SUB_SPI_READ    0x10
+#define PRO_SUB_MCU_CONFIG  0x21
+#define PRO_SUB_PLAYER      0x30
+#define PRO_SUB_HOME_LIGHT  0x38
+#define PRO_SUB_IMU         0x40
+#define PRO_SUB_VIBRATION   0x48
+#define PRO_SUB_VOLTAGE     0x50
+
+/* 入力レポートのボタンのビット（右・共通・左の 3 バイト） */
+#define PRO_Y       0x01
+#define PRO_X       0x02
+#define PRO_B       0x04
+#define PRO_A       0x08
+#define PRO_R       0x40
+#define PRO_ZR      0x80
+#define PRO_MINUS   0x01
+#define PRO_PLUS    0x02
+#define PRO_RCLICK  0x04
+#define PRO_LCLICK  0x08
+#define PRO_HOME    0x10
+#define PRO_CAPTURE 0x20
+#define PRO_DOWN    0x01
+#define PRO_UP      0x02
+#define PRO_RIGHT   0x04
+#define PRO_LEFT    0x08
+#define PRO_L       0x40
+#define PRO_ZL      0x80
+
+#define PRO_STICK_CENTER 2048 // 12 ビットのスティックの中央
+#define PRO_STICK_RANGE  2032 // 中央から倒し切りまで（校正データとして返す値）
+#define PRO_ACCEL_1G     4096 // 加速度 (±8G) の 1G
+
+/* 0x30 レポートに入れる入力 */
+typedef struct {
+	uint8_t  right;  // PRO_Y ... PRO_ZR
+	uint8_t  shared; // PRO_MINUS ... PRO_CAPTURE
+	uint8_t  left;   // PRO_DOWN ... PRO_ZL
+	uint16_t lx, ly, rx, ry; // 12 ビット、上・右が大きい
+	int16_t  pitch;  // 角速度（ジャイロの生の値、上向きが正）
+	int16_t  yaw;    // 角速度（右向きが正）
+} pro_input;
+
+/* 接続ごとに初期化する（ハンドシェイクからやり直す） */
+void ProControllerReset(void);
+
+/* ホストからの出力レポートを処理し、返答を用意する */
+void ProControllerOut(const uint8_t* data, uint8_t length);
+
+/* 用意した返答 (0x81 / 0x21) を report に書き、長さを返す（なければ 0） */
+uint8_t ProControllerReply(uint8_t* report);
+
+/* ハンドシェイクが終わり、0x30 を送る状態か */
+bool ProControllerStreaming(void);
+
+/* input から 0x30 レポートを作る（長さ PRO_REPORT_SIZE） */
+void ProControllerFull(const pro_input* input, uint8_t* report);
+
+#endif
@@ -0,0 +1,51 @@
+/* route.txt から route2c.py で生成（直接編集しない） */
+
+#ifndef _ROUTE_H_
+#define _ROUTE_H_
+
+/* EEPROM のプログラム (Macro.h) でのテーブルの番号 */
+typedef enum {
+	TABLE_ConnectController,
+	TABLE_SyncController,
+	TABLE_GoToAlterna,
+	TABLE_OpenOption,
+	TABLE_TurnOffGyro,
+	TABLE_SetSensitivityRight,
+	TABLE_JumpToStage,
+	TABLE_EnterStage,
+	TABLE_ClearStage,
+	TABLE_LunchDrone_lstick,
+	TABLE_LunchDrone_rstick,
+	TABLE_LunchDrone_hat,
+	TABLE_LunchDrone_buttons,
+	TABLE_ResetGyroSetting,
+	TABLE_BackToSplatsville,
+	TABLE_CloseMenus,
+	TABLE_QuitStage,
+	TABLE_Skip,
+	TABLE_COUNT
+} Table_t;
+
+/* テーブルの番号と Buttons_t の並びの CRC（プログラムはこれが同じファームウェアでだけ使われる） */
+#define ROUTE_SIGNATURE 0x8633
+
+/* Step.c 内の関数について定義 */
+command ConnectController(int index);
+command SyncController(int index);
+command GoToAlterna(int index);
+command OpenOption(int index);
+command TurnOffGyro(int index);
+command SetSensitivityRight(int index);
+command SetSensitivityLeft(int index);
+command JumpToStage(int index);
+command EnterStage(int index);
+command ClearStage(int index);
+command LunchDrone(int track, int index);
+command ResetGyroSetting(int index);
+command BackToSplatsville(int index);
+command CloseMenus(int index);
+command QuitStage(int index);
+command Skip(int index);
+uint16_t Accepts(command (*phase)(int), Buttons_t button);
+
+#endif
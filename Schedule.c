@@ -0,0 +1,78 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include <stddef.h>
+#include <string.h>
+#include <avr/eeprom.h>
+
+#include "Config.h"
+#include "Schedule.h"
+
+schedule_plan SchedulePlan;
+
+static schedule_goal goal;
+static schedule_goal ScheduleSaved EEMEM;
+static uint8_t save_offset = sizeof(schedule_goal); // 次に EEPROM に書くバイト（sizeof なら保存中でない）
+
+/* Config.h の設定どおりの目標（magic は無効のまま） */
+static schedule_goal DefaultGoal(void) {
+	schedule_goal config = {
+		.version    = SCHEDULE_VERSION,
+		.clears     = INFINITE_LOOP_MODE ? SCHEDULE_FOREVER : DRONE_CLEARS,
+		.drone_runs = DRONE_RUNS,
+	};
+	return config;
+}
+
+/* 目標の回数。SCHEDULE_AUTO の項目は Config.h の設定に従う */
+static schedule_plan Plan(const schedule_goal* g) {
+	schedule_plan plan = {
+		.clears     = (g->clears != SCHEDULE_AUTO) ? g->clears : INFINITE_LOOP_MODE ? SCHEDULE_FOREVER : DRONE_CLEARS,
+		.drone_runs = (g->drone_runs != SCHEDULE_AUTO) ? g->drone_runs : DRONE_RUNS,
+	};
+	return plan;
+}
+
+void ScheduleInit(void) {
+	eeprom_read_block(&goal, &ScheduleSaved, sizeof(schedule_goal));
+
+	// 未書き込み (0xFF) や古い版の目標は使わない
+	if (goal.magic != SCHEDULE_MAGIC || goal.version != SCHEDULE_VERSION) {
+		goal = DefaultGoal();
+	}
+	SchedulePlan = Plan(&goal);
+	save_offset = sizeof(schedule_goal);
+}
+
+bool ScheduleSet(const schedule_goal* next) {
+	// magic が無効な目標は、Config.h の設定に戻す指示として保存する
+	if (next->magic != SCHEDULE_MAGIC) {
+		goal = DefaultGoal();
+	} else if (next->version != SCHEDULE_VERSION) {
+		return false;
+	} else {
+		goal = *next;
+	}
+
+	// 周回中でも、次のクリア・ドローンの区切りから新しい計画に従う
+	SchedulePlan = Plan(&goal);
+	save_offset = 0;
+	return true;
+}
+
+schedule_report ScheduleReport(void) {
+	schedule_report report = { .goal = goal, .plan = SchedulePlan };
+	return report;
+}
+
+void ScheduleTask(void) {
+	if (save_offset == sizeof(schedule_goal) || !eeprom_is_ready()) {
+		return;
+	}
+
+	// 書き込みの完了を待たずに戻り、次の呼び出しで続きを書く
+	eeprom_update_byte((uint8_t*)&ScheduleSaved + save_offset, ((const uint8_t*)&goal)[save_offset]);
+	save_offset++;
+}
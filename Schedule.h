@@ -0,0 +1,64 @@
+/* Header file for Schedule.c */
+
+/* ------------------------------------------------------------ */
+/* ドローン1回あたりのクリア回数とドローンの起動回数の目標を持つ */
+/* 目標は EEPROM に置き、USB のベンダーリクエストで書き換えられる */
+/* ------------------------------------------------------------ */
+
+#ifndef _SCHEDULE_H_
+#define _SCHEDULE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCHEDULE_MAGIC   0x5C3D // 目標が有効なときの schedule_goal.magic
+#define SCHEDULE_VERSION 3      // schedule_goal の並びの版
+#define SCHEDULE_REQUEST 0x03   // ベンダーリクエストの bRequest
+                                // bmRequestType 0xC0 で schedule_report を返し、0x40 で schedule_goal を書き込む
+
+#define SCHEDULE_AUTO    0x00   // clears・drone_runs: Config.h の DRONE_CLEARS・DRONE_RUNS に従う
+#define SCHEDULE_FOREVER 0xFF   // clears: ドローンを起動せずにクリアを続ける
+
+/* USB で送る長さ。ホスト（gadget/reader、sim）の構造体も詰めて同じ長さにする */
+#define SCHEDULE_GOAL_SIZE   5
+#define SCHEDULE_REPORT_SIZE 7
+
+/* 目標（EEPROM に保存し、USB ではこの並びのリトルエンディアンで送る） */
+typedef struct __attribute__((packed)) {
+	uint16_t magic;      // SCHEDULE_MAGIC（それ以外なら Config.h の設定で周回する）
+	uint8_t  version;    // SCHEDULE_VERSION
+	uint8_t  clears;     // ドローン1回あたりのクリア回数、SCHEDULE_AUTO か SCHEDULE_FOREVER
+	uint8_t  drone_runs; // ドローンを起動する回数、SCHEDULE_AUTO なら DRONE_RUNS
+} schedule_goal;
+
+/* 目標から決めた計画 */
+typedef struct __attribute__((packed)) {
+	uint8_t  clears;     // ドローン1回あたりのクリア回数（SCHEDULE_FOREVER なら起動しない）
+	uint8_t  drone_runs; // ドローンを起動する回数
+} schedule_plan;
+
+/* SCHEDULE_REQUEST の返答（USB ではこの並びのリトルエンディアンで返す） */
+typedef struct __attribute__((packed)) {
+	schedule_goal goal; // 現在の目標（magic が無効なら Config.h の設定）
+	schedule_plan plan;
+} schedule_report;
+
+_Static_assert(sizeof(schedule_goal) == SCHEDULE_GOAL_SIZE, "schedule_goal の長さが USB で送る長さと違う");
+_Static_assert(sizeof(schedule_report) == SCHEDULE_REPORT_SIZE, "schedule_report の長さが USB で返す長さと違う");
+
+extern schedule_plan SchedulePlan; // エンジンが従う計画
+
+/* EEPROM の目標を読み、計画を決める */
+void ScheduleInit(void);
+
+/* 新しい目標で計画を決め直し、EEPROM への保存を始める */
+/* 版が違えば何もせず false を返す */
+bool ScheduleSet(const schedule_goal* goal);
+
+/* 現在の目標と計画 */
+schedule_report ScheduleReport(void);
+
+/* メインループで呼び、EEPROM の準備ができていれば 1 バイトずつ保存を進める */
+void ScheduleTask(void);
+
+#endif
@@ -0,0 +1,38 @@
+/* Header file for SeekIndex.c */
+
+/* ------------------------------------------------------------ */
+/* ルートを1本のタイムラインに展開した、フレーム位置の索引       */
+/* SeekIndex.c は `make -C sim index` で Step.c と Config.h から */
+/* 生成される（手で編集しない）                                 */
+/* ------------------------------------------------------------ */
+
+#ifndef _SEEK_INDEX_H_
+#define _SEEK_INDEX_H_
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#define SEEK_NONE    0xFFFF     // SeekPhaseStart[]: ルート上に現れないステップ
+#define SEEK_NO_LOOP 0xFFFFFFFF // SeekLoopFrame: ルートが DONE で終わる場合
+
+/* コマンドが切り替わるフレームごとのエンジンの状態 */
+/* （そのフレームのレポートを作る直前の値） */
+typedef struct {
+	uint32_t frame;           // CONNECT_CONTROLLER の先頭からのフレーム数
+	uint16_t duration_count;
+	uint8_t  step;            // Step_t
+	uint8_t  bufindex;
+	uint8_t  clear_count;
+	uint8_t  drone_count;
+	uint8_t  gyro_on;
+	int8_t   sensitivity_val;
+} seek_entry;
+
+extern const seek_entry SeekIndex[] PROGMEM;  // frame の昇順
+extern const uint16_t SeekIndexSize;
+extern const uint16_t SeekPhaseStart[] PROGMEM; // 各ステップが最初に現れる SeekIndex[] の位置
+extern const uint8_t SeekPhaseCount;
+extern const uint32_t SeekEndFrame;  // 索引の終わり（DONE またはループの折り返し）
+extern const uint32_t SeekLoopFrame; // 無限周回モードでループが戻るフレーム
+
+#endif
@@ -2,237 +2,422 @@
 /* スプラトゥーン3 オルタナのドローン起動を自動化 */
 /* 									by Dettsu3420 */
 /* ---------------------------------------------- */
+/* route.txt から route2c.py で生成（直接編集しない） */
+
+#include <avr/pgmspace.h>
 
 #include "Step.h"
+#include "Macro.h"
+#include "Config.h"
 
-/* コントローラーとして Nintendo Switchに接続後、少し待機させる [0 - 2] */
-command ConnectController(int index) {
+/* テーブルの1エントリ: 下位5ビットが Buttons_t、残りのビットが duration */
+static inline command Decode8(uint8_t entry, uint8_t echo) {
+	command cmd = { entry & 0x1F, entry >> 5, echo };
+	return cmd;
+}
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ NOTHING,   30 }, // [0]
-		{ A,         10 }, // [1]
-		{ NOTHING,   60 }, // [2]
-		{ END,        0 }
-	};
+static inline command Decode16(uint16_t entry, uint8_t echo) {
+	command cmd = { entry & 0x1F, entry >> 5, echo };
+	return cmd;
+}
 
-	return step[index];
+/* repeat を1回分だけ格納したテーブルで、ステップの index を格納した位置に直す */
+static inline int Repeat(int index, int at, int length, int count) {
+	if (index < at) return index;
+	if (index < at + length * count) return at + (index - at) % length;
+	return index - length * (count - 1);
 }
 
-/* コントローラーとしてNintendo Switchに認識させる [3 - 6] */
-command SyncController(int index) {
+/* 左右を反転したコマンドを返す */
+static command Mirror(command cmd) {
+	switch (cmd.button) {
+		case LEFT:
+			cmd.button = RIGHT;
+			break;
+		case L_LEFT:
+			cmd.button = L_RIGHT;
+			break;
+		case L_RIGHT:
+			cmd.button = L_LEFT;
+			break;
+		case RIGHT:
+			cmd.button = LEFT;
+			break;
+		case R_LEFT:
+			cmd.button = R_RIGHT;
+			break;
+		case R_RIGHT:
+			cmd.button = R_LEFT;
+			break;
+		default:
+			break;
+	}
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ TRIGGERS,  10 }, // [3]
-		{ NOTHING,   30 }, // [4]
-		{ A,         10 }, // [5]
-		{ NOTHING,   60 }, // [6]
-		{ END,        0 }
-	};
+	return cmd;
+}
 
-	return step[index];
+/* 記述のないトラック・終わったトラック */
+static inline command IdleTrack(uint8_t echo) {
+	command cmd = { END, 0, echo };
+	return cmd;
 }
 
-/* 広場からオルタナに移動する [7 - 12] */
-command GoToAlterna(int index) {
+/* SyncController_table: 5 entries, 10 bytes */
+static const uint16_t SyncController_table[] PROGMEM = {
+	TRIGGERS | (  10u << 5), // route.txt:35
+	NOTHING  | (  30u << 5), // route.txt:36
+	A        | (  10u << 5), // route.txt:37
+	NOTHING  | (  60u << 5), // route.txt:38
+	END      | (   0u << 5)
+};
+
+/* GoToAlterna_table: 7 entries, 14 bytes */
+static const uint16_t GoToAlterna_table[] PROGMEM = {
+	X        | (  10u << 5), // route.txt:43
+	NOTHING  | (  10u << 5), // route.txt:44
+	BOTTOM   | (   5u << 5), // route.txt:45
+	NOTHING  | (  10u << 5), // route.txt:46
+	A        | (  10u << 5), // route.txt:47
+	NOTHING  | ( 540u << 5), // route.txt:48
+	END      | ( 180u << 5)
+};
+
+/* OpenOption_table: 13 entries, 26 bytes */
+static const uint16_t OpenOption_table[] PROGMEM = {
+#if FAST_MENUS
+	X        | (   3u << 5), // route.txt:56
+	NOTHING  | (  41u << 5), // route.txt:57
+	L        | (   3u << 5), // route.txt:58
+	NOTHING  | (  22u << 5), // route.txt:59
+	A        | (   3u << 5), // route.txt:60
+	NOTHING  | (  28u << 5), // route.txt:61
+#else
+	X        | (  10u << 5), // route.txt:63
+	NOTHING  | (  10u << 5), // route.txt:64
+	L        | (   5u << 5), // route.txt:65
+	NOTHING  | (   5u << 5), // route.txt:66
+	A        | (   5u << 5), // route.txt:67
+	NOTHING  | (   5u << 5), // route.txt:68
+#endif
+	END      | (   0u << 5)
+};
+
+/* TurnOffGyro_table: 13 entries, 26 bytes */
+static const uint16_t TurnOffGyro_table[] PROGMEM = {
+#if FAST_MENUS
+	TOP      | (   3u << 5), // route.txt:75
+	NOTHING  | (   3u << 5), // route.txt:76
+	A        | (   3u << 5), // route.txt:77
+	NOTHING  | (  13u << 5), // route.txt:78
+	BOTTOM   | (   3u << 5), // route.txt:79
+	NOTHING  | (   3u << 5), // route.txt:80
+#else
+	TOP      | (   5u << 5), // route.txt:82
+	NOTHING  | (   5u << 5), // route.txt:83
+	A        | (   5u << 5), // route.txt:84
+	NOTHING  | (   5u << 5), // route.txt:85
+	BOTTOM   | (   5u << 5), // route.txt:86
+	NOTHING  | (   5u << 5), // route.txt:87
+#endif
+	END      | (   0u << 5)
+};
+
+/* SetSensitivityRight_table: 5 entries, 5 bytes */
+static const uint8_t SetSensitivityRight_table[] PROGMEM = {
+#if FAST_MENUS
+	RIGHT    | (   3u << 5), // route.txt:94
+	NOTHING  | (   3u << 5), // route.txt:95
+#else
+	RIGHT    | (   4u << 5), // route.txt:97
+	NOTHING  | (   4u << 5), // route.txt:98
+#endif
+	END      | (   0u << 5)
+};
+
+/* JumpToStage_table: 33 entries, 66 bytes */
+static const uint16_t JumpToStage_table[] PROGMEM = {
+#if FAST_MENUS
+	L        | (   3u << 5), // route.txt:108
+	NOTHING  | (  22u << 5), // route.txt:109
+	L        | (   3u << 5), // route.txt:110
+	NOTHING  | (  22u << 5), // route.txt:111
+	A        | (   3u << 5), // route.txt:112
+	NOTHING  | (  60u << 5), // route.txt:113
+	TOP      | (   3u << 5), // route.txt:115
+	NOTHING  | (   3u << 5), // route.txt:116
+	TOP      | (   3u << 5), // route.txt:115
+	NOTHING  | (   3u << 5), // route.txt:116
+	TOP      | (   3u << 5), // route.txt:118
+	NOTHING  | (   5u << 5), // route.txt:119
+	A        | (   3u << 5), // route.txt:120
+	NOTHING  | (  41u << 5), // route.txt:121
+	A        | (   3u << 5), // route.txt:122
+	NOTHING  | ( 992u << 5), // route.txt:123
+#else
+	L        | (  10u << 5), // route.txt:125
+	NOTHING  | (  10u << 5), // route.txt:126
+	L        | (  10u << 5), // route.txt:127
+	NOTHING  | (  10u << 5), // route.txt:128
+	A        | (  10u << 5), // route.txt:129
+	NOTHING  | (  10u << 5), // route.txt:130
+	TOP      | (   5u << 5), // route.txt:132
+	NOTHING  | (   5u << 5), // route.txt:133
+	TOP      | (   5u << 5), // route.txt:132
+	NOTHING  | (   5u << 5), // route.txt:133
+	TOP      | (   5u << 5), // route.txt:135
+	NOTHING  | (  10u << 5), // route.txt:136
+	A        | (  10u << 5), // route.txt:137
+	NOTHING  | (  10u << 5), // route.txt:138
+	A        | (  10u << 5), // route.txt:139
+	NOTHING  | ( 330u << 5), // route.txt:140
+#endif
+	END      | (   0u << 5)
+};
+
+/* EnterStage_table: 3 entries, 6 bytes */
+static const uint16_t EnterStage_table[] PROGMEM = {
+	ZL       | (  40u << 5), // route.txt:146
+	NOTHING  | ( 420u << 5), // route.txt:147
+	END      | ( 120u << 5)
+};
+
+/* ClearStage_table: 10 entries, 20 bytes */
+static const uint16_t ClearStage_table[] PROGMEM = {
+	RIGHT    | (   5u << 5), // route.txt:152
+	NOTHING  | (  10u << 5), // route.txt:153
+	A        | (   5u << 5), // route.txt:154
+	L_UP     | (  85u << 5), // route.txt:155
+	A        | (   5u << 5), // route.txt:156
+	NOTHING  | ( 145u << 5), // route.txt:157
+	ZR       | (  45u << 5), // route.txt:158
+	AIM_SHOT | (  30u << 5), // route.txt:159
+	NOTHING  | (1200u << 5), // route.txt:160
+	END      | (   0u << 5)
+};
+
+/* LunchDrone_lstick: 5 entries, 10 bytes */
+static const uint16_t LunchDrone_lstick[] PROGMEM = {
+	NOTHING  | (  16u << 5), // route.txt:168
+	AIM_MAP  | (  20u << 5), // route.txt:169
+	NOTHING  | ( 222u << 5), // route.txt:170
+	L_UP     | ( 202u << 5), // route.txt:171
+	END      | (   0u << 5)
+};
+
+/* LunchDrone_rstick: 3 entries, 6 bytes */
+static const uint16_t LunchDrone_rstick[] PROGMEM = {
+	NOTHING  | ( 236u << 5), // route.txt:174
+	R_LEFT   | (  23u << 5), // route.txt:175
+	END      | (   0u << 5)
+};
+
+/* LunchDrone_hat: 3 entries, 6 bytes */
+static const uint16_t LunchDrone_hat[] PROGMEM = {
+	NOTHING  | ( 650u << 5), // route.txt:178
+	TOP      | (   5u << 5), // route.txt:179
+	END      | (   0u << 5)
+};
+
+/* LunchDrone_buttons: 15 entries, 30 bytes */
+static const uint16_t LunchDrone_buttons[] PROGMEM = {
+	X        | (  10u << 5), // route.txt:182
+	NOTHING  | (  26u << 5), // route.txt:183
+	A        | (   5u << 5), // route.txt:184
+	NOTHING  | (  10u << 5), // route.txt:185
+	A        | (   5u << 5), // route.txt:186
+	NOTHING  | ( 305u << 5), // route.txt:187
+	B        | (  20u << 5), // route.txt:188
+	NOTHING  | (  75u << 5), // route.txt:189
+	A        | (   5u << 5), // route.txt:190
+	NOTHING  | ( 197u << 5), // route.txt:191
+	A        | (   5u << 5), // route.txt:192
+	NOTHING  | (  15u << 5), // route.txt:193
+	MINUS    | (   5u << 5), // route.txt:194
+	NOTHING  | (  90u << 5), // route.txt:195
+	END      | (   0u << 5)
+};
+
+/* ResetGyroSetting_table: 9 entries, 18 bytes */
+static const uint16_t ResetGyroSetting_table[] PROGMEM = {
+#if FAST_MENUS
+	TOP      | (   3u << 5), // route.txt:202
+	NOTHING  | (   3u << 5), // route.txt:203
+	A        | (   3u << 5), // route.txt:204
+	NOTHING  | (  13u << 5), // route.txt:205
+#else
+	TOP      | (   5u << 5), // route.txt:207
+	NOTHING  | (  10u << 5), // route.txt:208
+	A        | (   5u << 5), // route.txt:209
+	NOTHING  | (  10u << 5), // route.txt:210
+#endif
+	END      | (   0u << 5)
+};
+
+/* BackToSplatsville_table: 11 entries, 22 bytes */
+static const uint16_t BackToSplatsville_table[] PROGMEM = {
+#if FAST_MENUS
+	B        | (   3u << 5), // route.txt:217
+	NOTHING  | (  27u << 5), // route.txt:218
+	PLUS     | (   3u << 5), // route.txt:219
+	NOTHING  | (  41u << 5), // route.txt:220
+	A        | (   3u << 5), // route.txt:221
+#else
+	B        | (   5u << 5), // route.txt:223
+	NOTHING  | (  10u << 5), // route.txt:224
+	PLUS     | (   5u << 5), // route.txt:225
+	NOTHING  | (  10u << 5), // route.txt:226
+	A        | (   5u << 5), // route.txt:227
+#endif
+	END      | (   0u << 5)
+};
+
+/* CloseMenus_table: 5 entries, 10 bytes */
+static const uint16_t CloseMenus_table[] PROGMEM = {
+	/* 次の 2 ステップを 3 回繰り返す (route.txt:234) */
+#if FAST_MENUS
+	B        | (   3u << 5), // route.txt:236
+	NOTHING  | (  41u << 5), // route.txt:237
+#else
+	B        | (   5u << 5), // route.txt:239
+	NOTHING  | (  20u << 5), // route.txt:240
+#endif
+	END      | (   0u << 5)
+};
+
+/* QuitStage_table: 5 entries, 10 bytes */
+static const uint16_t QuitStage_table[] PROGMEM = {
+	PLUS     | (   5u << 5), // route.txt:247
+	NOTHING  | (  30u << 5), // route.txt:248
+	A        | (   5u << 5), // route.txt:249
+	NOTHING  | ( 300u << 5), // route.txt:250
+	END      | (   0u << 5)
+};
+
+/* Skip_table: 1 entries, 1 bytes */
+static const uint8_t Skip_table[] PROGMEM = {
+	END      | (   0u << 5)
+};
+
+/* ConnectController は SyncController_table の末尾と共有 */
+command ConnectController(int index) {
+
+	return MacroHas(TABLE_ConnectController) ? MacroAt(TABLE_ConnectController, index) : Decode16(pgm_read_word(STEP_AT(&SyncController_table[1], 4, index)), 2);
+}
+
+command SyncController(int index) {
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ X,		 10 }, // [7]
-		{ NOTHING,   10 }, // [8]
-		{ BOTTOM,     5 }, // [9]
-		{ NOTHING,   10 }, // [10]
-		{ A,         10 }, // [11]
-		{ NOTHING,  540 }, // [12]
-		{ END,		180 }
-	};
+	return MacroHas(TABLE_SyncController) ? MacroAt(TABLE_SyncController, index) : Decode16(pgm_read_word(STEP_AT(SyncController_table, 5, index)), 2);
+}
+
+command GoToAlterna(int index) {
 
-	return step[index];
+	return MacroHas(TABLE_GoToAlterna) ? MacroAt(TABLE_GoToAlterna, index) : Decode16(pgm_read_word(STEP_AT(GoToAlterna_table, 7, index)), 2);
 }
 
-/* メニューからオプションを開く [13 - 18] */
 command OpenOption(int index) {
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ X,         10 }, // [13]
-		{ NOTHING,   10 }, // [14]
-		{ L,          5 }, // [15]
-		{ NOTHING,    5 }, // [16]
-		{ A,          5 }, // [17]
-		{ NOTHING,    5 }, // [18]
-		{ END,		  0 }
-	};
-
-	return step[index];
-}
-	
-/* ジャイロ操作をOFFに設定する [19 - 24] */
+	return MacroHas(TABLE_OpenOption) ? MacroAt(TABLE_OpenOption, index) : Decode16(pgm_read_word(STEP_AT(OpenOption_table, sizeof(OpenOption_table) / sizeof(OpenOption_table[0]), index)), (FAST_MENUS ? 0 : 2));
+}
+
 command TurnOffGyro(int index) {
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ TOP,        5 }, // [19]
-		{ NOTHING,    5 }, // [20]
-		{ A,          5 }, // [21]
-		{ NOTHING,    5 }, // [22]
-		{ BOTTOM,     5 }, // [23]
-		{ NOTHING,    5 }, // [24]
-		{ END,		  0 }
-	};
-
-	return step[index];
-}
-
-/* 操作感度をプログラム用に最適化・元の操作感度に復元 [25 - 26] */
-command SetSensitivity(int index, int mode) {
-
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ END,		  0 }
-	};
-
-	static const command step_L[] = {
-		{ LEFT,		  4 }, // [25]
-		{ NOTHING,	  4 }, // [26]
-		{ END,		  0 }
-	};
-
-	static const command step_R[] = {
-		{ RIGHT,	  4 }, // [25]
-		{ NOTHING,	  4 }, // [26]
-		{ END,		  0 }
-	};
-
-	if (mode) {
-		return step_L[index];
-	} else {
-		return step_R[index];
-	}
+	return MacroHas(TABLE_TurnOffGyro) ? MacroAt(TABLE_TurnOffGyro, index) : Decode16(pgm_read_word(STEP_AT(TurnOffGyro_table, sizeof(TurnOffGyro_table) / sizeof(TurnOffGyro_table[0]), index)), (FAST_MENUS ? 0 : 2));
+}
+
+command SetSensitivityRight(int index) {
+
+	return MacroHas(TABLE_SetSensitivityRight) ? MacroAt(TABLE_SetSensitivityRight, index) : Decode8(pgm_read_byte(STEP_AT(SetSensitivityRight_table, sizeof(SetSensitivityRight_table) / sizeof(SetSensitivityRight_table[0]), index)), (FAST_MENUS ? 0 : 2));
+}
+
+command SetSensitivityLeft(int index) {
+
+	return Mirror(MacroHas(TABLE_SetSensitivityRight) ? MacroAt(TABLE_SetSensitivityRight, index) : Decode8(pgm_read_byte(STEP_AT(SetSensitivityRight_table, sizeof(SetSensitivityRight_table) / sizeof(SetSensitivityRight_table[0]), index)), (FAST_MENUS ? 0 : 2)));
 }
 
-/* ステージ1-8のヤカンへスーパージャンプ [27 - 42] */
 command JumpToStage(int index) {
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ L,         10 }, // [27]
-		{ NOTHING,   10 }, // [28]
-		{ L,         10 }, // [29]
-		{ NOTHING,   10 }, // [30]
-		{ A,         10 }, // [31]
-		{ NOTHING,   10 }, // [32]
-		{ TOP,        5 }, // [33]
-		{ NOTHING,    5 }, // [34]
-		{ TOP,        5 }, // [35]
-		{ NOTHING,    5 }, // [36]
-		{ TOP,        5 }, // [37]
-		{ NOTHING,   10 }, // [38]
-		{ A,         10 }, // [39]
-		{ NOTHING,   10 }, // [40]
-		{ A,         10 }, // [41]
-		{ NOTHING,  330 }, // [42]
-		{ END,		  0 }
-	};
-
-	return step[index];
-}
-
-/* ZLボタンを長押ししてヤカンに入る [43 - 44] */
-command EnterStage(int index) {
+	return MacroHas(TABLE_JumpToStage) ? MacroAt(TABLE_JumpToStage, index) : Decode16(pgm_read_word(STEP_AT(JumpToStage_table, sizeof(JumpToStage_table) / sizeof(JumpToStage_table[0]), index)), (FAST_MENUS ? 0 : 2));
+}
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ ZL,        40 }, // [43]
-		{ NOTHING,  420 }, // [44]
-		{ END,		120 }
-	};
+command EnterStage(int index) {
 
-	return step[index];
+	return MacroHas(TABLE_EnterStage) ? MacroAt(TABLE_EnterStage, index) : Decode16(pgm_read_word(STEP_AT(EnterStage_table, 3, index)), 2);
 }
 
-/* ステージ1-8をクリアする [45 - 52] （視点移動は配列外で実行） */
 command ClearStage(int index) {
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ RIGHT,      5 }, // [45]
-		{ NOTHING,   10 }, // [46]
-		{ A,          5 }, // [47]
-		{ L_UP,      85 }, // [48]
-		{ A,          5 }, // [49]
-		{ NOTHING,	145 }, // [50]
-		{ ZR,		 45 }, // [51]
-		{ AIM_SHOT,	 30 }, // 試作段階
-		{ NOTHING, 1200 }, // [52]
-		{ END,		  0 }
-	};
-
-	return step[index];
-}
-
-/* ドローンを起動してアイテムを探してきてもらう [53 - 69] */
-command LunchDrone(int index) {
-
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ X,         10 }, // [53]
-		{ NOTHING,    5 }, // [54]
-		{ AIM_MAP,	 20 }, // [55]
-		{ A,          5 }, // [56]
-		{ NOTHING,   10 }, // [57]
-		{ A,          5 }, // [58]
-		{ NOTHING,  175 }, // [59]
-		{ R_LEFT,	 23 }, // [60]
-		{ L_UP,     105 }, // [61]
-		{ JUMP,		 20 },
-		{ L_UP,		 75 },
-		{ A,          5 }, // [62]
-		{ NOTHING,  180 }, // [63]
-		{ TOP,        5 }, // [64]
-		{ NOTHING,   10 }, // [65]
-		{ A,          5 }, // [66]
-		{ NOTHING,   15 }, // [67]
-		{ MINUS,      5 }, // [68]
-		{ NOTHING,   90 }, // [69]
-		{ END,		  0 }
-	};
-
-	return step[index];
-}
-  
-/* メニューからオプションを開く（再呼び出し） [70 - 75] */
-
-/* 操作設定を元の状態に戻す（再呼び出し） [76 - 77] */
-
-/* ジャイロ操作の設定をONに戻す [78 - 81] */
-command ResetGyroSetting(int index) {
+	return MacroHas(TABLE_ClearStage) ? MacroAt(TABLE_ClearStage, index) : Decode16(pgm_read_word(STEP_AT(ClearStage_table, 10, index)), 2);
+}
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ TOP,        5 }, // [78]
-		{ NOTHING,   10 }, // [79]
-		{ A,          5 }, // [80]
-		{ NOTHING,   10 }, // [81]
-		{ END,		  0 }
-	};
+command LunchDrone(int track, int index) {
+
+	switch (track) {
+		case TRACK_LSTICK:
+			return MacroHas(TABLE_LunchDrone_lstick) ? MacroAt(TABLE_LunchDrone_lstick, index) : Decode16(pgm_read_word(STEP_AT(LunchDrone_lstick, 5, index)), 2);
+		case TRACK_RSTICK:
+			return MacroHas(TABLE_LunchDrone_rstick) ? MacroAt(TABLE_LunchDrone_rstick, index) : Decode16(pgm_read_word(STEP_AT(LunchDrone_rstick, 3, index)), 2);
+		case TRACK_HAT:
+			return MacroHas(TABLE_LunchDrone_hat) ? MacroAt(TABLE_LunchDrone_hat, index) : Decode16(pgm_read_word(STEP_AT(LunchDrone_hat, 3, index)), 2);
+		case TRACK_BUTTONS:
+			return MacroHas(TABLE_LunchDrone_buttons) ? MacroAt(TABLE_LunchDrone_buttons, index) : Decode16(pgm_read_word(STEP_AT(LunchDrone_buttons, 15, index)), 2);
+	}
 
-	return step[index];
+	return IdleTrack(2);
+}
+
+command ResetGyroSetting(int index) {
+
+	return MacroHas(TABLE_ResetGyroSetting) ? MacroAt(TABLE_ResetGyroSetting, index) : Decode16(pgm_read_word(STEP_AT(ResetGyroSetting_table, sizeof(ResetGyroSetting_table) / sizeof(ResetGyroSetting_table[0]), index)), (FAST_MENUS ? 0 : 2));
 }
 
-/* バンカラ街へ戻る [82 - 86] */
 command BackToSplatsville(int index) {
 
-	/* 入力されるコマンドを配列 step[] に格納 */
-	static const command step[] = {
-		{ B,          5 }, // [82]
-		{ NOTHING,   10 }, // [83]
-		{ PLUS,       5 }, // [84]
-		{ NOTHING,   10 }, // [85]
-		{ A,          5 }, // [86]
-		{ END,		  0 }
-	};
-
-	return step[index];
-};
\ No newline at end of file
+	return MacroHas(TABLE_BackToSplatsville) ? MacroAt(TABLE_BackToSplatsville, index) : Decode16(pgm_read_word(STEP_AT(BackToSplatsville_table, sizeof(BackToSplatsville_table) / sizeof(BackToSplatsville_table[0]), index)), (FAST_MENUS ? 0 : 2));
+}
+
+command CloseMenus(int index) {
+
+	return MacroHas(TABLE_CloseMenus) ? MacroAt(TABLE_CloseMenus, index) : Decode16(pgm_read_word(STEP_AT(CloseMenus_table, sizeof(CloseMenus_table) / sizeof(CloseMenus_table[0]), Repeat(index, 0, 2, 3))), (FAST_MENUS ? 0 : 2));
+}
+
+command QuitStage(int index) {
+
+	return MacroHas(TABLE_QuitStage) ? MacroAt(TABLE_QuitStage, index) : Decode16(pgm_read_word(STEP_AT(QuitStage_table, 5, index)), 2);
+}
+
+command Skip(int index) {
+
+	return MacroHas(TABLE_Skip) ? MacroAt(TABLE_Skip, index) : Decode8(pgm_read_byte(STEP_AT(Skip_table, 1, index)), (FAST_MENUS ? 0 : 2));
+}
+
+/* route.txt の accepts: phase を終える待機の最後の何フレームで、次のステップの最初の入力 button を先に送れるか */
+uint16_t Accepts(command (*phase)(int), Buttons_t button) {
+	if (phase == JumpToStage) {
+#if FAST_MENUS
+		switch (button) {
+			case ZL:
+				return 96;
+			default:
+				return 0;
+		}
+#else
+		switch (button) {
+			case ZL:
+				return 32;
+			default:
+				return 0;
+		}
+#endif
+	}
+
+	if (phase == ClearStage) {
+		switch (button) {
+			case ZL:
+				return 40;
+			default:
+				return 0;
+		}
+	}
+
+	return 0;
+}
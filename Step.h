@@ -1,5 +1,8 @@
 /* Header file for Step.c */
 
+#ifndef _STEP_H_
+#define _STEP_H_
+
 #include <stdint.h>
 
 /* ボタンの記述について Buttons_t で定義 */
@@ -30,6 +33,7 @@ typedef enum {
 	AIM_SHOT,
 	AIM_MAP,
 	JUMP,
+	MERGED,
 	NOTHING,
 	END
 } Buttons_t;
@@ -38,18 +42,26 @@ typedef enum {
 typedef struct {
 	Buttons_t button; // Buttons_t で定義された文字列から任意のものを 変数 button に代入するため定義
 	uint16_t duration; // 時間的な間隔をフレーム単位で示す変数 duration の定義
+	uint8_t echoes; // 各フレームのレポートを追加で送る回数（フェーズごとに route.txt の echo で指定）
 } command; // これを新たに command 型として定義
 
-/* Step.c 内の関数について定義 */
-command ConnectController(int index);
-command SyncController(int index);
-command GoToAlterna(int index);
-command OpenOption(int index);
-command TurnOffGyro(int index);
-command SetSensitivity(int index, int mode);
-command JumpToStage(int index);
-command EnterStage(int index);
-command ClearStage(int index);
-command LunchDrone(int index);
-command ResetGyroSetting(int index);
-command BackToSplatsville(int index);
\ No newline at end of file
+/* タイムライン（複数トラック）の各トラックについて定義 */
+/* トラックごとに独立した duration を持ち、毎フレーム1つのレポートに合成される */
+typedef enum {
+	TRACK_LSTICK,  // Lスティック (L_UP, L_DOWN, L_LEFT, L_RIGHT, AIM_MAP)
+	TRACK_RSTICK,  // Rスティック (R_UP, R_DOWN, R_LEFT, R_RIGHT)
+	TRACK_HAT,     // 十字キー (TOP, BOTTOM, LEFT, RIGHT)
+	TRACK_BUTTONS, // ボタン (A, B, X, Y, L, R, ZL, ZR, MINUS, PLUS, TRIGGERS)
+	TRACK_COUNT
+} Track_t;
+
+/* テーブルの参照方法について定義（テーブル、エントリ数、インデックスからエントリのアドレスを返す） */
+/* ホストシミュレーター (sim/) では END を越えた参照を検出するフックに置き換えられる */
+#ifndef STEP_AT
+#define STEP_AT(table, count, index) (&(table)[index])
+#endif
+
+/* Step.c 内の関数は route.txt から生成される */
+#include "Route.h"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include <stddef.h>
+
+#include "Task.h"
+#include "Timer.h"
+
+typedef struct {
+	task_function run; // NULL なら停止中
+	uint16_t period_ms;
+	uint32_t next_ms;
+} task;
+
+static task tasks[TASK_COUNT];
+static uint8_t last = TASK_COUNT - 1; // 最後に実行したタスク
+
+void TaskStart(task_id id, task_function run, uint16_t period_ms) {
+	if (tasks[id].run == NULL) {
+		tasks[id].period_ms = period_ms;
+		tasks[id].next_ms = TimerMillis();
+	}
+	tasks[id].run = run;
+}
+
+void TaskStop(task_id id) {
+	tasks[id].run = NULL;
+}
+
+void TaskRun(void) {
+	uint32_t now = TimerMillis();
+
+	// 前回の次のタスクから順に探し、同時に期限が来たタスクが交互に実行されるようにする
+	for (uint8_t i = 1; i <= TASK_COUNT; i++) {
+		uint8_t id = (last + i) % TASK_COUNT;
+		task* t = &tasks[id];
+
+		// 時計は一周するので、差の符号で期限を判定する
+		if (t->run == NULL || (int32_t)(now - t->next_ms) < 0) {
+			continue;
+		}
+
+		// 遅れた分はまとめて取り返さず、今から 1 周期後にする
+		t->next_ms += t->period_ms;
+		if ((int32_t)(now - t->next_ms) >= 0) {
+			t->next_ms = now + t->period_ms;
+		}
+		last = id;
+		t->run();
+		return;
+	}
+}
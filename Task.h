@@ -0,0 +1,36 @@
+/* Header file for Task.c */
+
+/* ------------------------------------------------------------ */
+/* Timer のミリ秒の時計で動く協調型のタスクスケジューラー       */
+/* USB の処理の合間に、期限が来たタスクを 1 回に 1 つだけ実行し */
+/* USB のポーリングへの応答が補助の処理で遅れないようにする     */
+/* ------------------------------------------------------------ */
+
+#ifndef _TASK_H_
+#define _TASK_H_
+
+#include <stdint.h>
+
+/* タスクの番号（タスクごとに 1 つ） */
+typedef enum {
+	TASK_BLACKBOX, // ブラックボックスの EEPROM への保存
+	TASK_ALERT,    // 終了時の LED の点滅とブザー (ALERT_WHEN_DONE)
+	TASK_SCHEDULE, // 周回の目標の EEPROM への保存
+	TASK_MACRO,    // アップロードされたプログラムの EEPROM への書き込み
+	TASK_COUNT
+} task_id;
+
+/* タスクは待たずにすぐ戻ること（続きは次の実行で行う） */
+typedef void (*task_function)(void);
+
+/* period_ms ごとに run を実行する（0 なら TaskRun() のたびに実行） */
+/* 実行中のタスクを再び開始すると、周期はそのままで関数だけ替わる */
+void TaskStart(task_id id, task_function run, uint16_t period_ms);
+
+/* タスクを止める */
+void TaskStop(task_id id);
+
+/* メインループから呼ぶ。期限が来たタスクを 1 つだけ実行する */
+void TaskRun(void);
+
+#endif
@@ -0,0 +1,36 @@
+/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#include "Timer.h"
+
+/* F_CPU / 64 / (TIMER_TOP + 1) = 1000 Hz */
+#define TIMER_TOP (F_CPU / 64 / 1000 - 1)
+
+static volatile uint32_t millis = 0;
+
+ISR(TIMER0_COMPA_vect) {
+	millis++;
+}
+
+void TimerInit(void) {
+	TCCR0A = (1 << WGM01);              // CTC
+	OCR0A = TIMER_TOP;
+	TCCR0B = (1 << CS01) | (1 << CS00); // clk / 64
+	TIMSK0 = (1 << OCIE0A);
+}
+
+uint32_t TimerMillis(void) {
+	uint32_t now;
+
+	// 4 バイトの読み出しの途中で割り込みが入らないようにする
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		now = millis;
+	}
+	return now;
+}
@@ -0,0 +1,20 @@
+/* Header file for Timer.c */
+
+/* ------------------------------------------------------------ */
+/* Timer0 の比較一致割り込みで 1 ミリ秒ごとに時刻を進める       */
+/* USB のポーリングとは独立した時計として使う                   */
+/* ------------------------------------------------------------ */
+
+#ifndef _TIMER_H_
+#define _TIMER_H_
+
+#include <stdint.h>
+
+/* Timer0 を 1 kHz の CTC モードで動かし、割り込みを有効にする */
+/* （GlobalInterruptEnable() の後から時刻が進む） */
+void TimerInit(void);
+
+/* TimerInit() からの経過時間（ミリ秒） */
+uint32_t TimerMillis(void);
+
+#endif
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+
+"""Replay a print's report stream on a model of the 320x120 post canvas.
+
+The stream is what the controller would send, one report per frame: the
+HAT, the buttons and the sticks. It comes from a stroke plan (strokes.py,
+planned on the spot or read from strokes.py -o), from the byte stream of
+img2c.py -f moves, or from a simulator trace (sim -t). The canvas model plays
+it frame by frame:
+  - the cursor starts homed at the top left and cannot leave the canvas,
+  - a HAT direction moves it one pixel when it is pressed, then again every
+    HAT_REPEAT frames once it has been held for HAT_DELAY frames,
+  - the left stick moves it along each axis by strokes.STICK_TRAVEL, the
+    longer it is held the faster, scaled by how far the stick is pushed.
+    The cursor keeps the fraction of a pixel this leaves it at and is
+    drawn at the nearest pixel; -e makes the game's travel that much off
+    the model, to check that the plan's re-homes keep the drift in check,
+  - A paints the brush (a square centred on the cursor, clipped by the
+    canvas) on every frame it is held, and B erases with it,
+  - BRUSH_UP and BRUSH_DOWN change the brush one size per press; it does
+    not paint for BRUSH_SETTLE frames after the change.
+The timings and the brushes are the post tool model of strokes.py, so a
+clean replay shows the stream is right for that model, not for the console.
+
+The canvas is then compared with the source bitmap. The report counts the
+frames spent drawing, travelling and switching brushes. It counts the wasted
+moves: travel beyond the shortest path (diagonals allowed) between the end
+of one stroke and the start of the next, and HAT presses against an edge
+that do not move the cursor. Re-homes are detours and count as wasted
+travel too. It also counts the pixels painted more than once,
+and the pixels drawn that should not be (extra) or not drawn that should
+be (missing). Any pixel error fails the run.
+"""
+
+import sys, re, struct, argparse
+import strokes, img2c
+
+WIDTH, HEIGHT = strokes.WIDTH, strokes.HEIGHT
+
+BUTTONS = {"Y": 0x01, "B": 0x02, "A": 0x04, "X": 0x08, "L": 0x10, "R": 0x20, "ZL": 0x40, "ZR": 0x80}
+HATS = {"TOP": 0, "TOP_RIGHT": 1, "RIGHT": 2, "BOTTOM_RIGHT": 3, "BOTTOM": 4,
+        "BOTTOM_LEFT": 5, "LEFT": 6, "TOP_LEFT": 7, "CENTER": 8}
+STEPS = [(0, -1), (1, -1), (1, 0), (1, 1), (0, 1), (-1, 1), (-1, 0), (-1, -1)]
+CENTER = 128
+
+class Report(object):
+  """One frame of the stream, as USB_JoystickReport_Input_t."""
+  __slots__ = ("buttons", "hat", "lx", "ly", "rx", "ry")
+  def __init__(self, buttons=0, hat=8, lx=CENTER, ly=CENTER, rx=CENTER, ry=CENTER):
+    self.buttons, self.hat, self.lx, self.ly, self.rx, self.ry = buttons, hat, lx, ly, rx, ry
+
+# ---------------------------------------------------------------- streams
+
+def from_ops(ops):
+  """The reports of a stroke plan, as strokes.reports() expands it."""
+  for buttons, hat, (lx, ly) in strokes.reports(ops):
+    mask = 0
+    for b in buttons:
+      mask |= BUTTONS[b]
+    yield Report(mask, HATS[hat.strip("_") or "CENTER"], lx, ly)
+
+def read_ops(path):
+  """A plan written by strokes.py -o."""
+  ops = []
+  for line in open(path):
+    fields = line.split()
+    if fields:
+      ops.append((fields[0],) + tuple(int(v) for v in fields[1:]))
+  return ops
+
+def read_moves(path):
+  """The plan in an image_moves array written by img2c.py -f moves."""
+  match = re.search(r"\[\d*\]\s*PROGMEM\s*=\s*\{([^}]*)\}", open(path).read())
+  if not match:
+    raise img2c.ImageError("cannot find an image_moves array in " + path)
+  data = bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", match.group(1)))
+  ops, brush, i = [], strokes.START_BRUSH, 0
+  while i < len(data) and data[i] != img2c.OP_END:
+    if data[i] == img2c.OP_BRUSH:
+      ops.append(("brush", brush, data[i + 1]))
+      brush = data[i + 1]
+      i += 2
+    elif data[i] == img2c.OP_HOME:
+      ops.append(("home", data[i + 1]))
+      i += 2
+    elif data[i] == img2c.OP_JUMP:
+      ops.append(("jump",) + struct.unpack("<hb", data[i + 1:i + 4]))
+      i += 4
+    else:
+      dx, dy = struct.unpack("<hb", data[i + 1:i + 4])
+      ops.append(("move" if data[i] == img2c.OP_MOVE else "stroke", dx, dy))
+      i += 4
+  return ops
+
+def read_trace(path, polls_per_frame):
+  """The reports of a sim -t trace (poll, step, bufindex, then the report bytes),
+  one in every polls_per_frame polls."""
+  for n, line in enumerate(open(path)):
+    if n % polls_per_frame:
+      continue
+    b = [int(v, 16) for v in line.split()[3:]]
+    yield Report(b[0] | b[1] << 8, b[2] & 0x0F, b[3], b[4], b[5], b[6])
+
+# ---------------------------------------------------------------- canvas
+
+class Canvas(object):
+  def __init__(self, stick_error=0.0):
+    self.pixels = bytearray(WIDTH * HEIGHT)
+    self.painted = bytearray(WIDTH * HEIGHT)   # times each pixel was painted
+    self.x, self.y = 0, 0                      # the pixel the cursor is drawn at
+    self.fx, self.fy = 0.0, 0.0                # where it is, with the fraction the stick leaves
+    self.held_stick = [0, 0]                   # frames the stick has been held along x and y
+    self.pushes = 0                            # frames the stick moved the cursor
+    self.stick_error = stick_error
+    self.brush = strokes.START_BRUSH
+    self.settle = 0
+    self.hat, self.held = 8, 0
+    self.buttons = 0
+    self.frames = {"draw": 0, "travel": 0, "brush": 0, "idle": 0}
+    self.travel = 0                            # pen-up moves since the last stroke
+    self.travel_from = None                    # where the last stroke ended
+    self.wasted = 0
+    self.blocked = 0
+
+  def shift(self, dx, dy):
+    self.fx = min(WIDTH - 1.0, max(0.0, self.fx + dx))
+    self.fy = min(HEIGHT - 1.0, max(0.0, self.fy + dy))
+    self.x, self.y = strokes.nearest_pixel(self.fx), strokes.nearest_pixel(self.fy)
+
+  def move(self, hat):
+    before = (self.fx, self.fy)
+    self.shift(*STEPS[hat])
+    if (self.fx, self.fy) == before:
+      self.blocked += 1
+
+  def push(self, lx, ly):
+    """Move the cursor by the stick's travel on this frame of its hold."""
+    travel = strokes.STICK_TRAVEL
+    step = [0.0, 0.0]
+    for axis, value in enumerate((lx, ly)):
+      if value == CENTER:
+        self.held_stick[axis] = 0
+        continue
+      n = self.held_stick[axis] = self.held_stick[axis] + 1
+      speed = travel[n] - travel[n - 1] if n < len(travel) else travel[-1] - travel[-2]
+      deflection = (value - CENTER) / float(CENTER - 1 if value > CENTER else CENTER)
+      step[axis] = speed * deflection * (1 + self.stick_error)
+    self.pushes += any(step)
+    self.shift(*step)
+
+  def paint(self, value):
+    r = strokes.BRUSHES[self.brush] // 2
+    for y in range(max(0, self.y - r), min(HEIGHT, self.y + r + 1)):
+      for x in range(max(0, self.x - r), min(WIDTH, self.x + r + 1)):
+        self.pixels[y * WIDTH + x] = value
+        if value:
+          self.painted[y * WIDTH + x] += 1
+
+  def play(self, report):
+    pressed = report.buttons & ~self.buttons
+    self.buttons = report.buttons
+
+    # The brush changes on a press, and settles before it paints.
+    if self.settle:
+      self.settle -= 1
+    for name, step in ((strokes.BRUSH_UP, 1), (strokes.BRUSH_DOWN, -1)):
+      if pressed & BUTTONS[name]:
+        brush = min(len(strokes.BRUSHES) - 1, max(0, self.brush + step))
+        if brush != self.brush:
+          self.brush, self.settle = brush, strokes.BRUSH_SETTLE
+
+    before, tapped, pushed = (self.x, self.y), self.hat < 8, any(self.held_stick)
+    if report.hat < 8:
+      self.held = self.held + 1 if report.hat == self.hat else 0
+      if self.held == 0 or (self.held >= strokes.HAT_DELAY and (self.held - strokes.HAT_DELAY) % strokes.HAT_REPEAT == 0):
+        self.move(report.hat)
+    self.hat = report.hat
+    self.push(report.lx, report.ly)
+    moved = (self.x, self.y) != before
+
+    drawing = report.buttons & (BUTTONS["A"] | BUTTONS["B"])
+    if drawing and not self.settle:
+      if self.travel_from is not None:
+        # Travel is wasted beyond the shortest path from the last stroke.
+        fx, fy = self.travel_from
+        self.wasted += max(0, self.travel - max(abs(self.x - fx), abs(self.y - fy)))
+        self.travel_from = None
+      self.travel = 0
+      self.paint(0 if report.buttons & BUTTONS["B"] else 1)
+    elif moved:
+      if self.travel_from is None:
+        self.travel_from = before
+      self.travel += max(abs(self.x - before[0]), abs(self.y - before[1]))
+
+    if drawing:
+      self.frames["draw"] += 1
+    elif self.settle or pressed & (BUTTONS[strokes.BRUSH_UP] | BUTTONS[strokes.BRUSH_DOWN]):
+      self.frames["brush"] += 1
+    elif report.hat < 8 or tapped or any(self.held_stick) or pushed:
+      # A tap's release is part of its travel, and so is the stick's.
+      self.frames["travel"] += 1
+    else:
+      self.frames["idle"] += 1
+
+def compare(canvas, rows):
+  missing = extra = 0
+  diff = bytearray(WIDTH * HEIGHT)
+  for y, row in enumerate(rows):
+    for x in range(WIDTH):
+      want, got = row >> x & 1, canvas.pixels[y * WIDTH + x]
+      missing += want and not got
+      extra += got and not want
+      # Black and white where the print is right; grey where it is not.
+      diff[y * WIDTH + x] = (0 if got else 255) if want == got else (160 if want else 96)
+  return missing, extra, diff
+
+# ---------------------------------------------------------------- output
+
+def main(argv):
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("image", nargs="?", default="image.c", help="the source: image.c, a .data file or a PNG (default image.c)")
+  parser.add_argument("-i", "--invert", action="store_true", help="the print draws the light pixels")
+  source = parser.add_mutually_exclusive_group()
+  source.add_argument("-p", "--plan", help="replay this plan (strokes.py -o) instead of planning one")
+  source.add_argument("-m", "--moves", help="replay the image_moves of this file (img2c.py -f moves)")
+  source.add_argument("-t", "--trace", help="replay this simulator trace (sim -t)")
+  parser.add_argument("--polls-per-frame", type=int, default=3, help="polls per frame in a trace (default 3: echo 2)")
+  parser.add_argument("-s", "--stick", help="the measured stick travel (strokes.py --stick)")
+  parser.add_argument("-e", "--stick-error", type=float, default=0.0,
+                      help="the game's stick travel is this much off the model, e.g. 0.002 for 0.2%% further")
+  parser.add_argument("-d", "--diff", help="write the canvas as a PNG, the wrong pixels in grey")
+  parser.add_argument("--fps", type=float, default=1000.0 / 24, help="frames per second (default: 3 polls of 8 ms)")
+  args = parser.parse_args(argv)
+
+  try:
+    if args.stick:
+      strokes.STICK_TRAVEL = strokes.read_stick(args.stick)
+    rows = strokes.read_image(args.image, args.invert)
+    if args.trace:
+      stream = read_trace(args.trace, args.polls_per_frame)
+    elif args.moves:
+      stream = from_ops(read_moves(args.moves))
+    elif args.plan:
+      stream = from_ops(read_ops(args.plan))
+    else:
+      stream = from_ops(strokes.best_plan(rows).ops)
+    canvas = Canvas(args.stick_error)
+    for report in stream:
+      canvas.play(report)
+  except (IOError, ValueError, IndexError, strokes.ImageError, img2c.ImageError) as e:
+    print("canvas: {}".format(e))
+    return 2
+
+  missing, extra, diff = compare(canvas, rows)
+  total = sum(canvas.frames.values())
+  repainted = sum(1 for n in canvas.painted if n > 1)
+  print("{}: {} frames, {:.1f} min".format(args.image, total, total / args.fps / 60))
+  for name in ("draw", "travel", "brush", "idle"):
+    print("  {:<8} {:>8} frames".format(name, canvas.frames[name]))
+  print("  wasted moves {:>6} ({} beyond the shortest path, {} against an edge)".format(
+    canvas.wasted + canvas.blocked, canvas.wasted, canvas.blocked))
+  print("  repainted    {:>6} pixels".format(repainted))
+  print("  pixel errors {:>6} ({} missing, {} extra)".format(missing + extra, missing, extra))
+  if canvas.pushes and not args.stick:
+    # The plan was made with this same travel, so its stick moves cannot miss here.
+    print("  stick travel not measured: the jumps were replayed with the planner's own model; pass -s")
+  if args.diff:
+    img2c.write_png(args.diff, bytes(diff))
+  return 1 if missing or extra else 0
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,535 @@
+/*
+Linux USB gadget build of the controller.
+
+Joystick.c and Descriptors.c are compiled unchanged against the stand-in
+headers in ../sim/include, and the LUFA endpoint calls made by HID_Task()
+are forwarded to a USB device controller through raw-gadget
+(/dev/raw-gadget). Control requests on endpoint 0 are answered with the
+firmware's own CALLBACK_USB_GetDescriptor(), so the host sees exactly the
+HORI descriptors of the AVR build.
+
+With dummy_hcd loaded the controller enumerates on the local machine, and
+reader (Reader.c) polls it like the Switch does. On a board with a real
+device controller, pass its driver and device names with -d and -u.
+
+raw-gadget is used rather than FunctionFS because a FunctionFS function
+cannot serve the device descriptor (VID/PID and strings belong to configfs),
+and only raw-gadget lets the firmware answer every request itself.
+
+The firmware runs on the main thread only. As on the AVR, where LUFA polls
+the control endpoint from USB_USBTask() (INTERRUPT_CONTROL_ENDPOINT is not
+set), control requests are answered from USB_USBTask() in the main loop.
+The threads only wait on raw-gadget's blocking calls: one fetches the next
+event and hands it over, one reads OUT reports, and one sends the IN report
+queued by Endpoint_ClearIN(), which keeps Endpoint_IsINReady() false until
+the host has polled it, like a busy endpoint bank.
+
+With -l each IN report is logged as "<report> <queued_ns> <sent_ns>"
+(CLOCK_MONOTONIC), which reader -l uses to measure end-to-end latency.
+*/
+
+#define main Firmware_Main
+#include "../Joystick.c"
+#undef main
+#include "../Descriptors.c"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/usb/ch9.h>
+#include <linux/usb/raw_gadget.h>
+
+// raw-gadget events added after the first kernel release of the interface.
+#define RAW_EVENT_SUSPEND    3
+#define RAW_EVENT_RESUME     4
+#define RAW_EVENT_RESET      5
+#define RAW_EVENT_DISCONNECT 6
+
+// Stand-ins for the I/O registers.
+volatile uint8_t PORTB, PORTD, DDRB, DDRD, MCUSR;
+volatile uint8_t TCCR0A, TCCR0B, OCR0A, TIMSK0;
+volatile uint8_t USB_DeviceState = DEVICE_STATE_Unattached;
+
+static int raw_fd = -1;
+static const char* udc_driver = "dummy_udc";
+static const char* udc_device = "dummy_udc.0";
+static FILE* report_log = NULL;
+static long max_reports = -1;
+static volatile sig_atomic_t stopping = 0;
+
+// The control request being answered, and whether the firmware took it (Endpoint_ClearSETUP()).
+USB_Request_Header_t USB_ControlRequest;
+static bool control_handled;
+// The data stage of a request from the host, read before the firmware sees the request.
+static uint8_t control_data[FIXED_CONTROL_ENDPOINT_SIZE];
+// Set while the firmware answers a vendor request on endpoint 0.
+static bool in_control = false;
+
+// Endpoint handles returned by raw-gadget, indexed by endpoint number.
+static int ep_handle[16];
+static uint8_t selected_ep;
+
+// The IN packet being assembled between Endpoint_Write_Stream_LE() and Endpoint_ClearIN(),
+// and the one InTask() is sending; in_busy is set from Endpoint_ClearIN() until the host took it.
+typedef struct {
+	struct usb_raw_ep_io io;
+	uint8_t data[JOYSTICK_EPSIZE];
+} in_packet_t;
+static in_packet_t in_packet, in_flight;
+static uint64_t in_queued;
+static bool in_busy = false;
+static long report_count_in = 0;
+
+static uint64_t Now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Busy waits of the firmware (the blinking after DONE) really wait here.
+void SimDelay(double ms) {
+	struct timespec ts = { (time_t)(ms / 1000), (long)(ms * 1000000) % 1000000000 };
+	nanosleep(&ts, NULL);
+}
+
+// We forward the endpoint configuration to the device controller.
+bool Endpoint_ConfigureEndpoint(const uint8_t Address, const uint8_t Type, const uint16_t Size, const uint8_t Banks) {
+	struct usb_endpoint_descriptor desc = {
+		.bLength          = USB_DT_ENDPOINT_SIZE,
+		.bDescriptorType  = USB_DT_ENDPOINT,
+		.bEndpointAddress = Address,
+		.bmAttributes     = Type,
+		.wMaxPacketSize   = Size,
+		.bInterval        = (Address & ENDPOINT_DIR_IN)
+			? ConfigurationDescriptor.HID_ReportINEndpoint.PollingIntervalMS
+			: ConfigurationDescriptor.HID_ReportOUTEndpoint.PollingIntervalMS,
+	};
+	int handle = ioctl(raw_fd, USB_RAW_IOCTL_EP_ENABLE, &desc);
+	if (handle < 0) {
+		perror("gadget: enable endpoint");
+		return false;
+	}
+
+	ep_handle[Address & 0x0F] = handle;
+	return true;
+}
+
+void Endpoint_SelectEndpoint(const uint8_t Address) {
+	selected_ep = Address;
+}
+
+// OUT reports are read by OutTask() and handed to HID_Task() one at a time;
+// OutTask() waits until HID_Task() has cleared the last one.
+static uint8_t out_report[JOYSTICK_EPSIZE];
+static uint16_t out_length;
+static bool out_pending = false;
+
+bool Endpoint_IsOUTReceived(void) {
+	return (selected_ep & 0x0F) == (JOYSTICK_OUT_EPADDR & 0x0F) && __atomic_load_n(&out_pending, __ATOMIC_ACQUIRE);
+}
+
+bool Endpoint_IsReadWriteAllowed(void) { return true; }
+uint16_t Endpoint_BytesInEndpoint(void) { return out_length; }
+
+void Endpoint_ClearOUT(void) {
+	// Only the report endpoint has OUT packets of its own to release.
+	if (in_control) {
+		return;
+	}
+	__atomic_store_n(&out_pending, false, __ATOMIC_RELEASE);
+}
+
+uint8_t Endpoint_Read_Stream_LE(void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed) {
+	uint16_t length = Length < out_length ? Length : out_length;
+
+	memcpy(Buffer, out_report, length);
+	memset((uint8_t*)Buffer + length, 0, Length - length);
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+// The IN endpoint is ready once InTask() has sent the previous report.
+bool Endpoint_IsINReady(void) {
+	return !stopping && !__atomic_load_n(&in_busy, __ATOMIC_ACQUIRE);
+}
+
+uint8_t Endpoint_Write_Stream_LE(const void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed) {
+	memcpy(in_packet.data, Buffer, Length);
+	in_packet.io.length = Length;
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+// The report is handed to InTask(), and the endpoint stays busy until the host has polled it.
+void Endpoint_ClearIN(void) {
+	// The status stage of a control request was already acknowledged with its data stage.
+	if (in_control) {
+		return;
+	}
+
+	in_flight = in_packet;
+	in_flight.io.ep = ep_handle[selected_ep & 0x0F];
+	in_flight.io.flags = 0;
+	in_queued = Now();
+	__atomic_store_n(&in_busy, true, __ATOMIC_RELEASE);
+}
+
+void USB_Init(void) {
+	struct usb_raw_init init = { .speed = USB_SPEED_FULL };
+
+	raw_fd = open("/dev/raw-gadget", O_RDWR);
+	if (raw_fd < 0) {
+		perror("gadget: /dev/raw-gadget (is raw_gadget loaded?)");
+		exit(1);
+	}
+
+	strncpy((char*)init.driver_name, udc_driver, UDC_NAME_LENGTH_MAX - 1);
+	strncpy((char*)init.device_name, udc_device, UDC_NAME_LENGTH_MAX - 1);
+	if (ioctl(raw_fd, USB_RAW_IOCTL_INIT, &init) < 0 || ioctl(raw_fd, USB_RAW_IOCTL_RUN, 0) < 0) {
+		perror("gadget: bind to the device controller");
+		exit(1);
+	}
+}
+
+static void Event(const struct usb_raw_event* event, const struct usb_ctrlrequest* req);
+
+// The event EventTask() fetched last, until USB_USBTask() has handled it.
+static struct {
+	struct usb_raw_event event;
+	struct usb_ctrlrequest req;
+} pending_event;
+static bool event_pending = false;
+
+// Polled from the main loop like LUFA's USB_USBTask(): the control requests are answered here.
+// With nothing to do we yield instead of spinning on HID_Task().
+void USB_USBTask(void) {
+	if (__atomic_load_n(&event_pending, __ATOMIC_ACQUIRE)) {
+		Event(&pending_event.event, &pending_event.req);
+		__atomic_store_n(&event_pending, false, __ATOMIC_RELEASE);
+	} else if (USB_DeviceState != DEVICE_STATE_Configured) {
+		SimDelay(1);
+	} else if (__atomic_load_n(&in_busy, __ATOMIC_ACQUIRE)) {
+		SimDelay(0.1);
+	}
+}
+
+static void Ep0Stall(void) {
+	ioctl(raw_fd, USB_RAW_IOCTL_EP0_STALL, 0);
+}
+
+// Acknowledge a request without a data stage, or read the data stage of an OUT request into control_data.
+static void Ep0Read(uint16_t length) {
+	struct {
+		struct usb_raw_ep_io io;
+		uint8_t data[FIXED_CONTROL_ENDPOINT_SIZE];
+	} packet = { .io = { .ep = 0, .length = length < sizeof(packet.data) ? length : sizeof(packet.data) } };
+
+	ioctl(raw_fd, USB_RAW_IOCTL_EP0_READ, &packet);
+	memcpy(control_data, packet.data, packet.io.length);
+}
+
+static void Ep0Write(const void* data, uint16_t length) {
+	struct {
+		struct usb_raw_ep_io io;
+		uint8_t data[1024];
+	} packet = { .io = { .ep = 0, .length = length < sizeof(packet.data) ? length : sizeof(packet.data) } };
+
+	memcpy(packet.data, data, packet.io.length);
+	ioctl(raw_fd, USB_RAW_IOCTL_EP0_WRITE, &packet);
+}
+
+void Endpoint_ClearSETUP(void) {
+	control_handled = true;
+}
+
+// A request without a data stage is acknowledged with an empty read, as SET_CONFIGURATION is.
+void Endpoint_ClearStatusStage(void) {
+	Ep0Read(0);
+}
+
+uint8_t Endpoint_Write_Control_Stream_LE(const void* const Buffer, uint16_t Length) {
+	Ep0Write(Buffer, Length < USB_ControlRequest.wLength ? Length : USB_ControlRequest.wLength);
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+// The EEPROM stand-in is ordinary memory.
+uint8_t Endpoint_Write_Control_EStream_LE(const void* const Buffer, uint16_t Length) {
+	return Endpoint_Write_Control_Stream_LE(Buffer, Length);
+}
+
+uint8_t Endpoint_Read_Control_Stream_LE(void* const Buffer, uint16_t Length) {
+	if (Length > USB_ControlRequest.wLength) {
+		Length = USB_ControlRequest.wLength;
+	}
+	if (Length > sizeof(control_data)) {
+		Length = sizeof(control_data);
+	}
+	memcpy(Buffer, control_data, Length);
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+// Timer0's compare interrupt, raised here once for every millisecond of CLOCK_MONOTONIC.
+void TIMER0_COMPA_vect(void);
+
+static void TimerTask(void) {
+	static uint64_t next_tick = 0;
+	uint64_t now = Now();
+
+	if (next_tick == 0) {
+		next_tick = now;
+	}
+	while (next_tick <= now) {
+		TIMER0_COMPA_vect();
+		next_tick += 1000000;
+	}
+}
+
+// We answer the control requests the LUFA stack would handle on the AVR.
+static void ControlRequest(const struct usb_ctrlrequest* req) {
+	uint16_t wValue = req->wValue, wIndex = req->wIndex, wLength = req->wLength;
+
+	USB_ControlRequest = (USB_Request_Header_t){
+		.bmRequestType = req->bRequestType,
+		.bRequest      = req->bRequest,
+		.wValue        = wValue,
+		.wIndex        = wIndex,
+		.wLength       = wLength,
+	};
+
+	if (req->bRequest == USB_REQ_GET_DESCRIPTOR && (req->bRequestType & USB_DIR_IN)) {
+		const void* address;
+		uint16_t size = CALLBACK_USB_GetDescriptor(wValue, wIndex, &address);
+
+		if (size == NO_DESCRIPTOR) {
+			Ep0Stall();
+			return;
+		}
+		Ep0Write(address, size < wLength ? size : wLength);
+		return;
+	}
+
+	if ((req->bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD && req->bRequest == USB_REQ_SET_CONFIGURATION) {
+		if ((wValue & 0xFF) == ConfigurationDescriptor.Config.ConfigurationNumber) {
+			EVENT_USB_Device_ConfigurationChanged();
+			ioctl(raw_fd, USB_RAW_IOCTL_VBUS_DRAW, ConfigurationDescriptor.Config.MaxPowerConsumption);
+			ioctl(raw_fd, USB_RAW_IOCTL_CONFIGURE, 0);
+			USB_DeviceState = DEVICE_STATE_Configured;
+		} else {
+			USB_DeviceState = DEVICE_STATE_Addressed;
+		}
+		Ep0Read(0);
+		return;
+	}
+
+	if ((req->bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD && req->bRequest == USB_REQ_GET_CONFIGURATION) {
+		uint8_t config = (USB_DeviceState == DEVICE_STATE_Configured) ? ConfigurationDescriptor.Config.ConfigurationNumber : 0;
+		Ep0Write(&config, 1);
+		return;
+	}
+
+	if ((req->bRequestType & USB_TYPE_MASK) == USB_TYPE_CLASS && !(req->bRequestType & USB_DIR_IN)) {
+		// SetIdle, SetProtocol and SetReport are accepted and ignored, as on the AVR.
+		EVENT_USB_Device_ControlRequest();
+		Ep0Read(wLength);
+		return;
+	}
+
+	if ((req->bRequestType & USB_TYPE_MASK) == USB_TYPE_VENDOR) {
+		// Vendor requests are answered by the firmware itself, or stalled if it does not know them.
+		// The data stage of a request from the host is taken first, so the firmware can read it.
+		bool out = !(req->bRequestType & USB_DIR_IN) && wLength > 0;
+		if (out) {
+			Ep0Read(wLength);
+		}
+		control_handled = false;
+		in_control = true;
+		EVENT_USB_Device_ControlRequest();
+		in_control = false;
+		if (!control_handled && !out) {
+			Ep0Stall();
+		}
+		return;
+	}
+
+	Ep0Stall();
+}
+
+// A raw-gadget event, handled on the main thread from USB_USBTask().
+static void Event(const struct usb_raw_event* event, const struct usb_ctrlrequest* req) {
+	static uint8_t awake_state = DEVICE_STATE_Unattached;
+
+	switch (event->type) {
+		case USB_RAW_EVENT_CONNECT:
+			USB_DeviceState = DEVICE_STATE_Powered;
+			EVENT_USB_Device_Connect();
+			break;
+		case USB_RAW_EVENT_CONTROL:
+			ControlRequest(req);
+			break;
+		case RAW_EVENT_RESET:
+			USB_DeviceState = DEVICE_STATE_Default;
+			break;
+		case RAW_EVENT_DISCONNECT:
+			USB_DeviceState = DEVICE_STATE_Unattached;
+			EVENT_USB_Device_Disconnect();
+			break;
+		case RAW_EVENT_SUSPEND:
+			awake_state = USB_DeviceState;
+			USB_DeviceState = DEVICE_STATE_Suspended;
+			EVENT_USB_Device_Suspend();
+			break;
+		case RAW_EVENT_RESUME:
+			USB_DeviceState = awake_state;
+			break;
+	}
+}
+
+// Waits for the next raw-gadget event and hands it to USB_USBTask(), one at a time.
+static void* EventTask(void* arg) {
+	while (!stopping) {
+		pending_event.event.type = 0;
+		pending_event.event.length = sizeof(pending_event.req);
+		if (ioctl(raw_fd, USB_RAW_IOCTL_EVENT_FETCH, &pending_event) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			perror("gadget: fetch event");
+			break;
+		}
+
+		__atomic_store_n(&event_pending, true, __ATOMIC_RELEASE);
+		while (!stopping && __atomic_load_n(&event_pending, __ATOMIC_ACQUIRE)) {
+			SimDelay(0.1);
+		}
+	}
+
+	return NULL;
+}
+
+// Sends the report queued by Endpoint_ClearIN(); the write returns once the host has polled it.
+static void* InTask(void* arg) {
+	while (!stopping) {
+		if (!__atomic_load_n(&in_busy, __ATOMIC_ACQUIRE)) {
+			SimDelay(0.1);
+			continue;
+		}
+
+		if (ioctl(raw_fd, USB_RAW_IOCTL_EP_WRITE, &in_flight) < 0) {
+			if (errno != EINTR && errno != ESHUTDOWN) {
+				perror("gadget: IN report");
+			}
+		} else {
+			if (report_log) {
+				fprintf(report_log, "%ld %llu %llu\n", report_count_in, (unsigned long long)in_queued, (unsigned long long)Now());
+			}
+			if (++report_count_in == max_reports) {
+				stopping = 1;
+			}
+		}
+		__atomic_store_n(&in_busy, false, __ATOMIC_RELEASE);
+	}
+
+	return NULL;
+}
+
+// The host sends output reports: the Switch mirrors the inputs of the HORI
+// pad, and drives the handshake of a Pro Controller (PRO_CONTROLLER).
+// Each one is passed to HID_Task() through Endpoint_IsOUTReceived().
+static void* OutTask(void* arg) {
+	struct {
+		struct usb_raw_ep_io io;
+		uint8_t data[JOYSTICK_EPSIZE];
+	} packet;
+
+	while (!stopping) {
+		if (USB_DeviceState != DEVICE_STATE_Configured) {
+			SimDelay(1);
+			continue;
+		}
+		packet.io.ep = ep_handle[JOYSTICK_OUT_EPADDR & 0x0F];
+		packet.io.flags = 0;
+		packet.io.length = sizeof(packet.data);
+		int length = ioctl(raw_fd, USB_RAW_IOCTL_EP_READ, &packet);
+		if (length < 0) {
+			if (errno != EINTR) {
+				SimDelay(1);
+			}
+			continue;
+		}
+
+		memcpy(out_report, packet.data, length);
+		out_length = length;
+		__atomic_store_n(&out_pending, true, __ATOMIC_RELEASE);
+		while (!stopping && __atomic_load_n(&out_pending, __ATOMIC_ACQUIRE)) {
+			SimDelay(1);
+		}
+	}
+
+	return NULL;
+}
+
+static void Stop(int sig) {
+	stopping = 1;
+}
+
+static void usage(void) {
+	fprintf(stderr,
+		"usage: gadget [-d driver] [-u device] [-l log] [-n reports]\n"
+		"  -d  device controller driver (default dummy_udc)\n"
+		"  -u  device controller instance (default dummy_udc.0)\n"
+		"  -l  log every IN report with its queued and sent times\n"
+		"  -n  exit after this many IN reports\n");
+}
+
+int main(int argc, char* argv[]) {
+	pthread_t events, in, out;
+	struct sigaction stop = { .sa_handler = Stop };
+	int opt;
+
+	while ((opt = getopt(argc, argv, "d:u:l:n:h")) != -1) {
+		switch (opt) {
+			case 'd': udc_driver = optarg; break;
+			case 'u': udc_device = optarg; break;
+			case 'n': max_reports = atol(optarg); break;
+			case 'l':
+				report_log = fopen(optarg, "w");
+				if (!report_log) {
+					perror(optarg);
+					return 1;
+				}
+				// Line buffered, so reader can match the reports while we are still running.
+				setvbuf(report_log, NULL, _IOLBF, 0);
+				break;
+			default: usage(); return 2;
+		}
+	}
+
+	// No SA_RESTART, so a blocked IN write returns when we are interrupted.
+	sigaction(SIGINT, &stop, NULL);
+	sigaction(SIGTERM, &stop, NULL);
+
+	MCUSR = 1 << PORF;
+	SetupHardware();
+	pthread_create(&events, NULL, EventTask, NULL);
+	pthread_create(&in, NULL, InTask, NULL);
+	pthread_create(&out, NULL, OutTask, NULL);
+
+	// The firmware's main loop.
+	while (!stopping && state != DONE) {
+		TimerTask();
+		HID_Task();
+		USB_USBTask();
+		TaskRun();
+	}
+
+	fprintf(stderr, "gadget: %ld reports sent, route %s\n", report_count_in, state == DONE ? "done" : "interrupted");
+	if (report_log) {
+		fclose(report_log);
+	}
+
+	return 0;
+}
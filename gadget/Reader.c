@@ -0,0 +1,536 @@
+/*
+Host-side reader for the Linux gadget build.
+
+Finds the controller by its HORI VID/PID, detaches the kernel HID driver,
+and keeps interrupt IN transfers queued on the report endpoint through
+usbfs, so the host controller polls at the endpoint's bInterval the way
+the Switch does. The run is summarised as one JSON object on stdout: poll
+cadence, sustained throughput and, given the gadget's log (-l), the
+end-to-end latency from a report being queued by HID_Task() to its arrival
+here. With -t every report is traced to stderr as "<report> <bytes...>",
+which can be compared with the report bytes of `sim -t`.
+
+With -m the controller is instead asked for its SRAM usage (the firmware's
+MEMORY_REQUEST vendor request) and the answer is printed as JSON. With
+-b ram or -b eeprom the black box (BLACKBOX_REQUEST) is written to stdout
+as the firmware keeps it, for sim -r. With -s the scheduler's goal and
+plan (SCHEDULE_REQUEST) are printed as JSON, and -g first sends it a new
+goal, which takes effect from the next clear or drone run and is kept in
+the controller's EEPROM.
+
+With -u a program compiled by route2c.py -p is uploaded to the
+controller's EEPROM (MACRO_REQUEST), part by part, and committed; the
+controller plays its tables from its next power-on. -u erase removes the
+program and -u status only prints the state, both as JSON.
+*/
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/usbdevice_fs.h>
+
+#include "../BlackBox.h"
+#include "../Memory.h"
+#include "../Schedule.h"
+#include "../Macro.h"
+
+#define VENDOR_ID   0x0F0D
+#define PRODUCT_ID  0x0092
+#define INTERFACE   0
+#define IN_EPADDR   0x81
+#define EPSIZE      64
+#define MAX_QUEUED  8
+
+static uint64_t Now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static unsigned ReadHex(const char* dir, const char* name) {
+	char path[512];
+	unsigned value = 0;
+	snprintf(path, sizeof(path), "/sys/bus/usb/devices/%s/%s", dir, name);
+	FILE* f = fopen(path, "r");
+	if (f) {
+		if (fscanf(f, "%x", &value) != 1) {
+			value = 0;
+		}
+		fclose(f);
+	}
+	return value;
+}
+
+static unsigned ReadDec(const char* dir, const char* name) {
+	char path[512];
+	unsigned value = 0;
+	snprintf(path, sizeof(path), "/sys/bus/usb/devices/%s/%s", dir, name);
+	FILE* f = fopen(path, "r");
+	if (f) {
+		if (fscanf(f, "%u", &value) != 1) {
+			value = 0;
+		}
+		fclose(f);
+	}
+	return value;
+}
+
+// We wait for the gadget to enumerate and open its usbfs node.
+static int OpenController(int timeout_s) {
+	for (int tries = 0; tries <= timeout_s * 10; tries++) {
+		DIR* devices = opendir("/sys/bus/usb/devices");
+		struct dirent* entry;
+
+		while (devices && (entry = readdir(devices))) {
+			if (ReadHex(entry->d_name, "idVendor") == VENDOR_ID && ReadHex(entry->d_name, "idProduct") == PRODUCT_ID) {
+				char path[64];
+				snprintf(path, sizeof(path), "/dev/bus/usb/%03u/%03u",
+					ReadDec(entry->d_name, "busnum"), ReadDec(entry->d_name, "devnum"));
+				closedir(devices);
+				return open(path, O_RDWR);
+			}
+		}
+		if (devices) {
+			closedir(devices);
+		}
+		usleep(100000);
+	}
+
+	errno = ENODEV;
+	return -1;
+}
+
+static int CompareU64(const void* a, const void* b) {
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return (x > y) - (x < y);
+}
+
+// Print {"min", "mean", "p99", "max"} in microseconds; the samples are sorted in place.
+static void PrintStats(const char* name, uint64_t* samples, long count) {
+	double sum = 0;
+
+	if (count == 0) {
+		printf("\"%s\": null", name);
+		return;
+	}
+	qsort(samples, count, sizeof(samples[0]), CompareU64);
+	for (long i = 0; i < count; i++) {
+		sum += samples[i];
+	}
+	printf("\"%s\": {\"min\": %.1f, \"mean\": %.1f, \"p99\": %.1f, \"max\": %.1f}", name,
+		samples[0] / 1000.0, sum / count / 1000.0, samples[(count - 1) * 99 / 100] / 1000.0, samples[count - 1] / 1000.0);
+}
+
+// Latency of report i is its arrival here minus the time HID_Task() queued it on the gadget.
+// Reports the gadget sent before we claimed the interface (to the kernel HID driver) are skipped.
+static long Latencies(const char* log_path, uint64_t claimed, const uint64_t* arrivals, long count, uint64_t* latencies) {
+	FILE* log = fopen(log_path, "r");
+	long n, skipped = 0, matched = 0;
+	unsigned long long queued, sent;
+
+	if (!log) {
+		perror(log_path);
+		return 0;
+	}
+	while (matched < count && fscanf(log, "%ld %llu %llu", &n, &queued, &sent) == 3) {
+		if (sent < claimed && matched == 0) {
+			skipped++;
+			continue;
+		}
+		latencies[matched] = arrivals[matched] - queued;
+		matched++;
+	}
+	fclose(log);
+
+	if (skipped) {
+		fprintf(stderr, "reader: %ld reports were read before the interface was claimed\n", skipped);
+	}
+	return matched;
+}
+
+// The firmware answers in the layout of memory_usage, little endian like this host.
+static int QueryMemory(int fd) {
+	memory_usage usage;
+	struct usbdevfs_ctrltransfer request = {
+		.bRequestType = 0xC0, // device to host, vendor, device
+		.bRequest     = MEMORY_REQUEST,
+		.wLength      = sizeof(usage),
+		.timeout      = 1000,
+		.data         = &usage,
+	};
+
+	if (ioctl(fd, USBDEVFS_CONTROL, &request) != sizeof(usage)) {
+		perror("reader: memory request");
+		return 1;
+	}
+	printf("{\"ram\": %u, \"data\": %u, \"bss\": %u, \"stack\": %u, \"free\": %u}\n",
+		usage.ram, usage.data, usage.bss, usage.stack, usage.free);
+	return 0;
+}
+
+// The ring as it is in SRAM, or the copy saved to EEPROM by the last gap, disconnect or reset.
+static int QueryBlackBox(int fd, const char* source) {
+	static blackbox_log log;
+	struct usbdevfs_ctrltransfer request = {
+		.bRequestType = 0xC0, // device to host, vendor, device
+		.bRequest     = BLACKBOX_REQUEST,
+		.wValue       = strcmp(source, "eeprom") == 0 ? BLACKBOX_EEPROM : BLACKBOX_RAM,
+		.wLength      = sizeof(log),
+		.timeout      = 1000,
+		.data         = &log,
+	};
+
+	if (ioctl(fd, USBDEVFS_CONTROL, &request) != sizeof(log)) {
+		perror("reader: black box request");
+		return 1;
+	}
+	if (fwrite(&log, sizeof(log), 1, stdout) != 1) {
+		perror("reader: black box");
+		return 1;
+	}
+	return 0;
+}
+
+// -g clears[,drone_runs], as sim -g; "config" goes back to the settings in Config.h.
+static bool ParseGoal(const char* text, schedule_goal* goal) {
+	unsigned runs = SCHEDULE_AUTO;
+	char clears[16];
+
+	if (strcmp(text, "config") == 0) {
+		memset(goal, 0, sizeof(*goal));
+		return true;
+	}
+	int fields = sscanf(text, "%15[^,],%u", clears, &runs);
+	if (fields < 1 || runs > 255) {
+		return false;
+	}
+	*goal = (schedule_goal){
+		.magic      = SCHEDULE_MAGIC,
+		.version    = SCHEDULE_VERSION,
+		.drone_runs = runs,
+	};
+	if (strcmp(clears, "auto") == 0) {
+		goal->clears = SCHEDULE_AUTO;
+	} else if (strcmp(clears, "forever") == 0) {
+		goal->clears = SCHEDULE_FOREVER;
+	} else {
+		int n = atoi(clears);
+		if (n < 1 || n >= SCHEDULE_FOREVER) {
+			return false;
+		}
+		goal->clears = n;
+	}
+	return true;
+}
+
+// Send the goal (if any), then print the goal and plan the firmware holds, little endian like this host.
+static int Schedule(int fd, const schedule_goal* goal) {
+	schedule_report report;
+
+	if (goal) {
+		struct usbdevfs_ctrltransfer request = {
+			.bRequestType = 0x40, // host to device, vendor, device
+			.bRequest     = SCHEDULE_REQUEST,
+			.wLength      = SCHEDULE_GOAL_SIZE,
+			.timeout      = 1000,
+			.data         = (void*)goal,
+		};
+		if (ioctl(fd, USBDEVFS_CONTROL, &request) != SCHEDULE_GOAL_SIZE) {
+			perror("reader: schedule goal");
+			return 1;
+		}
+	}
+
+	struct usbdevfs_ctrltransfer request = {
+		.bRequestType = 0xC0, // device to host, vendor, device
+		.bRequest     = SCHEDULE_REQUEST,
+		.wLength      = SCHEDULE_REPORT_SIZE,
+		.timeout      = 1000,
+		.data         = &report,
+	};
+	if (ioctl(fd, USBDEVFS_CONTROL, &request) != SCHEDULE_REPORT_SIZE) {
+		perror("reader: schedule request");
+		return 1;
+	}
+
+	printf("{\"goal\": %s, \"clears\": ", report.goal.magic == SCHEDULE_MAGIC ? "true" : "false");
+	if (report.plan.clears == SCHEDULE_FOREVER) {
+		printf("\"forever\"");
+	} else {
+		printf("%u", report.plan.clears);
+	}
+	printf(", \"drone_runs\": %u}\n", report.plan.drone_runs);
+
+	// A goal the firmware did not take (another version) leaves the old one.
+	if (goal && goal->magic == SCHEDULE_MAGIC && memcmp(&report.goal, goal, sizeof(*goal)) != 0) {
+		fprintf(stderr, "reader: the controller kept its previous goal\n");
+		return 1;
+	}
+	return 0;
+}
+
+static const char* const MacroStates[] = { "none", "active", "invalid", "writing", "ready" };
+
+static bool MacroControl(int fd, uint8_t type, uint16_t operation, uint16_t offset, void* data, uint16_t length) {
+	struct usbdevfs_ctrltransfer request = {
+		.bRequestType = type,
+		.bRequest     = MACRO_REQUEST,
+		.wValue       = offset,
+		.wIndex       = operation,
+		.wLength      = length,
+		.timeout      = 1000,
+		.data         = data,
+	};
+	return ioctl(fd, USBDEVFS_CONTROL, &request) == length;
+}
+
+// The controller writes each part to EEPROM from its main loop, a byte every 3.4 ms at most.
+static bool WaitMacro(int fd, macro_status* status) {
+	for (int tries = 0; tries < 1000; tries++) {
+		if (!MacroControl(fd, 0xC0, 0, 0, status, sizeof(*status))) {
+			perror("reader: macro request");
+			return false;
+		}
+		if (!status->busy) {
+			return true;
+		}
+		usleep(2000);
+	}
+	fprintf(stderr, "reader: the controller is still writing its EEPROM\n");
+	return false;
+}
+
+// Upload a program (or erase it, or only print the state), as sim -u does against the simulator.
+static int Upload(int fd, const char* path) {
+	static uint8_t program[0x10000];
+	macro_status status;
+	size_t length = 0;
+
+	if (strcmp(path, "status") != 0 && strcmp(path, "erase") != 0) {
+		FILE* f = fopen(path, "rb");
+		if (!f) {
+			perror(path);
+			return 1;
+		}
+		length = fread(program, 1, sizeof(program), f);
+		fclose(f);
+	}
+	if (!WaitMacro(fd, &status)) {
+		return 1;
+	}
+
+	if (strcmp(path, "erase") == 0) {
+		if (!MacroControl(fd, 0x40, MACRO_ERASE, 0, NULL, 0) || !WaitMacro(fd, &status)) {
+			perror("reader: macro erase");
+			return 1;
+		}
+	} else if (strcmp(path, "status") != 0) {
+		macro_header header;
+		memcpy(&header, program, sizeof(header));
+		if (length < sizeof(header) || header.magic != MACRO_MAGIC || header.version != status.version) {
+			fprintf(stderr, "reader: %s is not a program of version %u\n", path, status.version);
+			return 1;
+		}
+		// A program for other tables would be refused at the commit; this says why.
+		if (header.route != status.route) {
+			fprintf(stderr, "reader: %s is for route 0x%04X, the controller runs route 0x%04X\n", path, header.route, status.route);
+			return 1;
+		}
+		if (length > status.size) {
+			fprintf(stderr, "reader: %s has %zu bytes, the controller keeps %u\n", path, length, status.size);
+			return 1;
+		}
+		for (size_t offset = 0; offset < length; offset += MACRO_CHUNK) {
+			uint16_t part = (length - offset < MACRO_CHUNK) ? length - offset : MACRO_CHUNK;
+			if (!MacroControl(fd, 0x40, MACRO_WRITE, offset, program + offset, part) || !WaitMacro(fd, &status)) {
+				perror("reader: macro write");
+				return 1;
+			}
+		}
+		if (!MacroControl(fd, 0x40, MACRO_COMMIT, 0, NULL, 0) || !WaitMacro(fd, &status)) {
+			perror("reader: macro commit");
+			return 1;
+		}
+	}
+
+	printf("{\"state\": \"%s\", \"tables\": %u, \"route\": \"0x%04X\", \"written\": %u, \"size\": %u}\n",
+		status.state < sizeof(MacroStates) / sizeof(MacroStates[0]) ? MacroStates[status.state] : "unknown",
+		status.tables, status.route, status.written, status.size);
+	if (length && (status.state != MACRO_READY || status.written != length)) {
+		fprintf(stderr, "reader: the controller did not take the program\n");
+		return 1;
+	}
+	return 0;
+}
+
+static void usage(void) {
+	fprintf(stderr,
+		"usage: reader [-t] [-n reports] [-q queued] [-w seconds] [-l gadget_log]\n"
+		"       reader -m\n"
+		"       reader -b ram|eeprom > blackbox\n"
+		"       reader -s | -g clear,drone[,clears[,drone_runs]] | -g config\n"
+		"       reader -u program.bin | -u erase | -u status\n"
+		"  -t  trace every report to stderr\n"
+		"  -n  reports to read (default 10000)\n"
+		"  -q  transfers kept queued on the endpoint (default 2)\n"
+		"  -w  seconds to wait for the controller to enumerate (default 10)\n"
+		"  -l  the gadget's report log, to measure end-to-end latency\n"
+		"  -m  print the controller's SRAM usage and deepest stack\n"
+		"  -b  write the controller's black box to stdout, from SRAM or its EEPROM copy\n"
+		"  -s  print the scheduler's goal and plan\n"
+		"  -g  send the scheduler a goal: the clears per drone run (a number, auto for\n"
+		"      DRONE_CLEARS or forever), then the drone runs (0 for DRONE_RUNS); config goes\n"
+		"      back to the settings in Config.h\n"
+		"  -u  upload a program (route2c.py -p) to the controller's EEPROM, used from its next\n"
+		"      power-on; erase removes it, status prints the state of the program\n");
+}
+
+int main(int argc, char* argv[]) {
+	bool trace = false;
+	long count = 10000;
+	int queued = 2;
+	int wait_s = 10;
+	const char* log_path = NULL;
+	bool memory = false;
+	const char* blackbox = NULL;
+	bool schedule = false;
+	schedule_goal goal;
+	bool send_goal = false;
+	const char* program = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "tn:q:w:l:mb:sg:u:h")) != -1) {
+		switch (opt) {
+			case 't': trace = true; break;
+			case 'n': count = atol(optarg); break;
+			case 'q': queued = atoi(optarg); break;
+			case 'w': wait_s = atoi(optarg); break;
+			case 'l': log_path = optarg; break;
+			case 'm': memory = true; break;
+			case 'b': blackbox = optarg; break;
+			case 's': schedule = true; break;
+			case 'g':
+				if (!ParseGoal(optarg, &goal)) {
+					usage();
+					return 2;
+				}
+				schedule = send_goal = true;
+				break;
+			case 'u': program = optarg; break;
+			default: usage(); return 2;
+		}
+	}
+	if (count <= 0 || queued < 1 || queued > MAX_QUEUED
+		|| (blackbox && strcmp(blackbox, "ram") != 0 && strcmp(blackbox, "eeprom") != 0)) {
+		usage();
+		return 2;
+	}
+
+	int fd = OpenController(wait_s);
+	if (fd < 0) {
+		perror("reader: controller not found");
+		return 1;
+	}
+	if (memory) {
+		return QueryMemory(fd);
+	}
+	if (blackbox) {
+		return QueryBlackBox(fd, blackbox);
+	}
+	if (schedule) {
+		return Schedule(fd, send_goal ? &goal : NULL);
+	}
+	if (program) {
+		return Upload(fd, program);
+	}
+
+	// We take the interface away from the kernel HID driver.
+	struct usbdevfs_ioctl detach = { .ifno = INTERFACE, .ioctl_code = USBDEVFS_DISCONNECT };
+	ioctl(fd, USBDEVFS_IOCTL, &detach);
+	unsigned int interface = INTERFACE;
+	if (ioctl(fd, USBDEVFS_CLAIMINTERFACE, &interface) < 0) {
+		perror("reader: claim interface");
+		return 1;
+	}
+	uint64_t claimed = Now();
+
+	static struct usbdevfs_urb urbs[MAX_QUEUED];
+	static uint8_t buffers[MAX_QUEUED][EPSIZE];
+	for (int i = 0; i < queued; i++) {
+		urbs[i].type = USBDEVFS_URB_TYPE_INTERRUPT;
+		urbs[i].endpoint = IN_EPADDR;
+		urbs[i].buffer = buffers[i];
+		urbs[i].buffer_length = EPSIZE;
+		if (ioctl(fd, USBDEVFS_SUBMITURB, &urbs[i]) < 0) {
+			perror("reader: submit");
+			return 1;
+		}
+	}
+
+	uint64_t* arrivals = calloc(count, sizeof(uint64_t));
+	uint64_t* intervals = calloc(count, sizeof(uint64_t));
+	long reports = 0;
+	uint64_t bytes = 0;
+
+	while (reports < count) {
+		struct usbdevfs_urb* urb;
+
+		if (ioctl(fd, USBDEVFS_REAPURB, &urb) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			perror("reader: reap");
+			break;
+		}
+		uint64_t now = Now();
+
+		if (urb->status != 0) {
+			fprintf(stderr, "reader: transfer failed with status %d\n", urb->status);
+			break;
+		}
+		arrivals[reports] = now;
+		if (reports > 0) {
+			intervals[reports - 1] = now - arrivals[reports - 1];
+		}
+		bytes += urb->actual_length;
+
+		if (trace) {
+			const uint8_t* data = urb->buffer;
+			fprintf(stderr, "%ld", reports);
+			for (int i = 0; i < urb->actual_length; i++) {
+				fprintf(stderr, " %02x", data[i]);
+			}
+			fprintf(stderr, "\n");
+		}
+		reports++;
+
+		if (ioctl(fd, USBDEVFS_SUBMITURB, urb) < 0) {
+			perror("reader: resubmit");
+			break;
+		}
+	}
+
+	double seconds = reports > 1 ? (arrivals[reports - 1] - arrivals[0]) / 1e9 : 0;
+	printf("{\"reports\": %ld, \"seconds\": %.3f, \"reports_per_second\": %.1f, \"bytes_per_second\": %.1f, ",
+		reports, seconds, seconds > 0 ? (reports - 1) / seconds : 0, seconds > 0 ? bytes / seconds : 0);
+	PrintStats("interval_us", intervals, reports > 0 ? reports - 1 : 0);
+	printf(", ");
+	if (log_path) {
+		uint64_t* latencies = calloc(reports, sizeof(uint64_t));
+		PrintStats("latency_us", latencies, Latencies(log_path, claimed, arrivals, reports, latencies));
+		free(latencies);
+	} else {
+		printf("\"latency_us\": null");
+	}
+	printf("}\n");
+
+	return reports == count ? 0 : 1;
+}
@@ -1,4 +1,307 @@
+/* Generated by img2c.py from ironic.data (raw, hash dc721b18f4742dd5a38f3b547c2d7badb8cbd07e). Do not edit. */
+
 #include <stdint.h>
 #include <avr/pgmspace.h>
 
-const uint8_t image_data[0x12c1] PROGMEM = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x80, 0x58, 0xd0, 0xda, 0x6a, 0x5d, 0xbb, 0xff, 0x6f, 0xff, 0xef, 0xb7, 0xdd, 0x2d, 0xbd, 0xfb, 0xbf, 0x7d, 0xfb, 0xbe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x20, 0x24, 0x55, 0xb7, 0xef, 0xfe, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x10, 0x48, 0xaa, 0xde, 0xfe, 0xb7, 0x6f, 0xff, 0xf7, 0x7d, 0xff, 0x76, 0xfb, 0xee, 0xd7, 0xff, 0xef, 0xdf, 0xf7, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x28, 0x20, 0xdd, 0xfa, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0xfd, 0x57, 0xbf, 0xfd, 0x7f, 0xfb, 0xff, 0xbf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x20, 0x90, 0x72, 0x6b, 0xef, 0xee, 0xfe, 0xff, 0x7e, 0xf7, 0xef, 0x6f, 0xbb, 0xfd, 0xff, 0xed, 0xff, 0xfe, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x10, 0x48, 0xad, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xfd, 0xfe, 0xfe, 0x6b, 0xdb, 0xff, 0xdf, 0xf7, 0xf7, 0xbf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x20, 0x80, 0xd4, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xb7, 0xdf, 0xff, 0xff, 0xfb, 0xbf, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x0, 0x4, 0xa9, 0xa5, 0xef, 0xdb, 0xfe, 0xbd, 0xf7, 0xfb, 0xbb, 0xbf, 0xfd, 0x76, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x20, 0x8, 0x52, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xff, 0xfd, 0xef, 0xbd, 0xfb, 0xbf, 0xb7, 0xfb, 0xfd, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x0, 0x48, 0x92, 0xfe, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0x6f, 0xdf, 0xf7, 0xd7, 0xfb, 0xff, 0xff, 0x6f, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x10, 0xb4, 0xa9, 0x6f, 0xf7, 0xef, 0xff, 0xff, 0xfb, 0xb7, 0xff, 0x7b, 0xaf, 0x7e, 0xff, 0xfb, 0xdf, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x20, 0x24, 0x69, 0x77, 0xff, 0xfe, 0xff, 0xdd, 0xfd, 0xfe, 0xff, 0xfb, 0xff, 0x7d, 0xfb, 0xdf, 0x6f, 0xff, 0xbe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x0, 0x0, 0xea, 0xde, 0xed, 0xbb, 0xff, 0xff, 0xdf, 0xdf, 0xfe, 0xdf, 0xfe, 0xef, 0xf7, 0x7f, 0xff, 0xfb, 0x77, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x8, 0xd5, 0xed, 0x5e, 0xf7, 0xfd, 0xff, 0xff, 0xf7, 0x77, 0xff, 0xb7, 0x7f, 0xdf, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x1, 0x40, 0x48, 0xba, 0x56, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xfd, 0xf7, 0xdf, 0xdf, 0xbf, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb4, 0x6, 0x0, 0x10, 0x6d, 0xab, 0xb5, 0x7a, 0xdf, 0xff, 0xff, 0xaf, 0xfd, 0x6f, 0xdf, 0xb7, 0xff, 0x7f, 0xff, 0xfb, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x69, 0xd, 0x0, 0xb0, 0xf6, 0xdd, 0x6e, 0xb7, 0xfb, 0xdd, 0xf6, 0xfe, 0xbf, 0xff, 0xfb, 0xff, 0xdf, 0xff, 0xfb, 0xff, 0xef, 0x7e, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x4a, 0x59, 0x40, 0x48, 0xad, 0xb2, 0xf6, 0xed, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xfd, 0x7f, 0xfb, 0xfd, 0xff, 0x6f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xb6, 0xab, 0x80, 0xb0, 0xb6, 0xa7, 0x6d, 0x57, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdf, 0xbd, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x49, 0x36, 0x1, 0xea, 0xdd, 0x4a, 0xbd, 0xbf, 0xfb, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x7, 0xe, 0x6, 0x1e, 0xf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x24, 0x6d, 0x5, 0x6d, 0xdb, 0x5d, 0xeb, 0xed, 0xee, 0xfe, 0xdf, 0xdb, 0x7d, 0xff, 0xdf, 0xfe, 0x7d, 0xff, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe4, 0xe4, 0x3c, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1, 0xd2, 0x2, 0xf4, 0xaf, 0xb3, 0xda, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0x7b, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x2, 0x6c, 0x3, 0xda, 0xde, 0xd6, 0xed, 0x6e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1, 0xd9, 0xc6, 0xfd, 0xdd, 0xbb, 0xb7, 0xff, 0xbb, 0xfd, 0xf7, 0xbf, 0xed, 0xff, 0xed, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xe4, 0xf, 0xe6, 0x1c, 0xe, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0, 0xa5, 0x8d, 0xf7, 0xbf, 0xb6, 0x7e, 0xdd, 0x7e, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xbb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x6e, 0x61, 0xdf, 0x7b, 0xff, 0xed, 0xf6, 0xd7, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xbf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x6d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3, 0xb9, 0xeb, 0xfd, 0xdf, 0xbf, 0xff, 0x6f, 0xef, 0xfe, 0xfd, 0xbf, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0x7b, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xd2, 0xff, 0x7f, 0xf5, 0xb7, 0xdf, 0xfa, 0xfe, 0xbf, 0xff, 0xf7, 0xbf, 0xfb, 0xfb, 0xff, 0xfd, 0xef, 0xef, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x6d, 0xb9, 0xbf, 0xfd, 0xff, 0xef, 0xbd, 0x6d, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xda, 0xf4, 0xf7, 0xef, 0xda, 0x7e, 0x7f, 0xdf, 0xb7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xb7, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xee, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xb7, 0xda, 0xff, 0x7f, 0xf7, 0xe9, 0xf7, 0xdb, 0xfe, 0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x33, 0xfa, 0xff, 0xff, 0xab, 0xd7, 0xee, 0xb5, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0x7f, 0xfb, 0x7f, 0xff, 0xf7, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x3f, 0xfd, 0xfd, 0xbd, 0x5d, 0xbe, 0xbd, 0xdf, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xdb, 0xff, 0x7e, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x9f, 0xee, 0xbf, 0xff, 0xf6, 0xea, 0xdb, 0xfb, 0x7b, 0x7f, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x9a, 0xfd, 0xff, 0xef, 0xab, 0x55, 0xff, 0xb7, 0xff, 0xef, 0xef, 0xff, 0x7f, 0xfb, 0xdf, 0xfd, 0xff, 0xff, 0xdf, 0xb7, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x94, 0x7f, 0xff, 0xff, 0x2d, 0xfb, 0xf6, 0x6f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xfb, 0x7f, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x88, 0xf6, 0xef, 0xf6, 0xdb, 0xd6, 0xdf, 0xfd, 0xed, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfd, 0xef, 0xff, 0xfb, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x62, 0xff, 0xff, 0x5f, 0x57, 0x29, 0xfd, 0xdf, 0xfe, 0xfe, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf7, 0xbf, 0xff, 0xbd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xff, 0xff, 0xbf, 0x9f, 0xf6, 0x6a, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xee, 0xff, 0xff, 0xfe, 0xca, 0xbf, 0xeb, 0xed, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x60, 0xff, 0xee, 0x76, 0xfb, 0xbd, 0xed, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0xff, 0xed, 0x77, 0x35, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xd0, 0xfe, 0xff, 0xdf, 0xdf, 0xee, 0xdb, 0x7a, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xef, 0xbb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x68, 0xf7, 0x7f, 0x7b, 0xbb, 0x5f, 0xf7, 0xed, 0xbf, 0xfb, 0x7f, 0xbf, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xfd, 0xbf, 0xff, 0xff, 0xe7, 0xc, 0xfe, 0xf, 0xe, 0xe6, 0x3c, 0xf, 0xfc, 0xf, 0xe, 0xe4, 0xc, 0xfe, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0xef, 0xf6, 0xfd, 0xae, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xed, 0xff, 0xde, 0xff, 0xff, 0xff, 0x7, 0xe4, 0xfc, 0xe7, 0xe4, 0xe4, 0x3c, 0xe7, 0xfc, 0xc7, 0xe7, 0xe4, 0xe4, 0xfc, 0xff, 0xf, 0xa8, 0xff, 0xfe, 0xb7, 0xad, 0xb5, 0x7b, 0xfb, 0xf6, 0xff, 0xef, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xe7, 0x4, 0xfc, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0xf, 0xe6, 0x4c, 0x6, 0xfc, 0xff, 0x1f, 0x74, 0xff, 0xdf, 0x5f, 0xdb, 0xee, 0xdf, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0xff, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0x7f, 0xe4, 0x1c, 0xe7, 0xff, 0xff, 0xf, 0xe8, 0xfb, 0xff, 0xaf, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xe7, 0xc, 0xfe, 0xf, 0xc, 0xe, 0x1c, 0xe, 0xfc, 0x7, 0xe, 0xbc, 0xf, 0xfe, 0xff, 0xf, 0x48, 0xdf, 0xff, 0x7f, 0xb5, 0xd9, 0x6d, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xed, 0xf7, 0xbb, 0xef, 0xfe, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xb4, 0xff, 0xfb, 0xbf, 0xaa, 0xbb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xe0, 0xfd, 0x7f, 0x7f, 0x49, 0xed, 0xb6, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xc0, 0xb6, 0xff, 0xbf, 0xb5, 0x76, 0x6f, 0xdb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdb, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xa4, 0x7f, 0xed, 0x77, 0x4a, 0xed, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x68, 0xef, 0xfb, 0xff, 0x92, 0xaa, 0xdb, 0xee, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xd4, 0xfe, 0xb6, 0xbf, 0xb5, 0x54, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xd4, 0xfb, 0xef, 0x5d, 0xa3, 0x75, 0xbd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0x7f, 0x7f, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf, 0x6, 0x6, 0xe, 0x6, 0xe, 0xfe, 0x9f, 0x7, 0xe, 0x46, 0xfe, 0xff, 0xff, 0x7, 0xa8, 0xbe, 0xef, 0xef, 0x16, 0xad, 0xdb, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0xe4, 0xe4, 0xc4, 0xff, 0xf, 0xe6, 0xe4, 0x4, 0xfc, 0xff, 0xff, 0xf, 0x58, 0xbf, 0xb6, 0xbf, 0x6d, 0x52, 0xed, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0x4, 0xe4, 0xf, 0xfe, 0x9f, 0xe7, 0xe7, 0xa4, 0xfc, 0xff, 0xff, 0xf, 0xf0, 0x56, 0xff, 0xf6, 0xcb, 0xb4, 0x76, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe4, 0xe4, 0xe7, 0x7f, 0xfc, 0x9f, 0xe7, 0xe7, 0xe4, 0xfc, 0xff, 0xff, 0x1f, 0x0, 0xa8, 0xdd, 0x6f, 0x9f, 0xca, 0xed, 0xfe, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf, 0x3e, 0xe6, 0xc, 0xe6, 0x7, 0xfe, 0x9f, 0xe7, 0xf, 0xe6, 0xfc, 0xff, 0xff, 0xf, 0x0, 0x90, 0xfb, 0xbe, 0x75, 0x55, 0xdb, 0xef, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x8, 0x48, 0xef, 0xfb, 0xfb, 0xaa, 0xb6, 0xbd, 0xef, 0xff, 0xff, 0xfd, 0xb7, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0xa8, 0xb6, 0xb7, 0xcf, 0x55, 0xed, 0xf6, 0x7e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x40, 0x7d, 0x7f, 0xbb, 0xaf, 0xda, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xd0, 0xee, 0xed, 0x7f, 0x2d, 0xdb, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x88, 0xba, 0xbf, 0xd5, 0x76, 0xb5, 0xb5, 0xff, 0xef, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x10, 0xf5, 0xf6, 0xbf, 0x5d, 0xda, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x52, 0x6e, 0x7f, 0xdb, 0xba, 0x75, 0xfb, 0xef, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x7f, 0xe4, 0xe0, 0xc0, 0xf1, 0xe0, 0x60, 0xe0, 0xe0, 0x7f, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xff, 0xff, 0x1f, 0x0, 0xa4, 0xda, 0xeb, 0xbf, 0x75, 0xed, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0x7f, 0x40, 0x4e, 0xce, 0x73, 0x4e, 0x4e, 0x4e, 0xce, 0x7f, 0x4e, 0x4e, 0xfc, 0x79, 0xfc, 0xff, 0xff, 0x1f, 0x0, 0x4a, 0xed, 0xde, 0xb6, 0xcd, 0xaa, 0xfe, 0xfb, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x4a, 0x40, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xc0, 0x7f, 0x4e, 0xce, 0xe0, 0xf9, 0xe0, 0xff, 0xff, 0x1f, 0x0, 0x54, 0xbb, 0xf7, 0x6d, 0x55, 0x75, 0xbb, 0x7f, 0xf7, 0xdf, 0xfb, 0xff, 0xee, 0xef, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0x7e, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xfe, 0x7f, 0x4e, 0xce, 0xc7, 0xc9, 0xc7, 0xf3, 0xff, 0x3f, 0x0, 0xa8, 0x76, 0x7b, 0xbf, 0x6a, 0xdb, 0xf7, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x57, 0x7f, 0xce, 0xe0, 0xc0, 0xe1, 0xe0, 0x40, 0xfe, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x63, 0xe0, 0xf3, 0xff, 0x3f, 0x0, 0xe2, 0xdd, 0xff, 0xdf, 0xd5, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x3f, 0x0, 0x48, 0xff, 0xb6, 0xfb, 0x4b, 0xb7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0, 0xfa, 0xea, 0xff, 0xff, 0xb7, 0xec, 0xfb, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0xe9, 0xff, 0xff, 0xff, 0xa5, 0xdd, 0xde, 0xef, 0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0x56, 0xbf, 0xfd, 0xff, 0xaf, 0xba, 0xf7, 0xfd, 0xff, 0xfd, 0x7d, 0xdf, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xfe, 0xea, 0xff, 0xdf, 0x56, 0xf7, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xf3, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xfb, 0xad, 0xaa, 0x6f, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc9, 0xff, 0x7f, 0x80, 0x3d, 0xfd, 0xff, 0xbf, 0xaf, 0x76, 0xfb, 0xfe, 0xff, 0xff, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdf, 0x7f, 0x60, 0x4e, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x7f, 0xe0, 0x71, 0xe4, 0xe0, 0xe0, 0xf3, 0xf9, 0xff, 0x7f, 0x80, 0x7e, 0xed, 0x77, 0x7f, 0x5b, 0xfd, 0xdd, 0x7f, 0xf7, 0x7f, 0xff, 0xff, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0x40, 0x7c, 0xce, 0xf3, 0xe0, 0xff, 0xff, 0x40, 0xeb, 0xbb, 0xfd, 0xdb, 0xcd, 0xaa, 0xf7, 0xed, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0xca, 0x60, 0xc0, 0xf3, 0xf9, 0xff, 0xff, 0x0, 0x95, 0xde, 0xdf, 0xff, 0x97, 0x76, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0xf7, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0xce, 0x73, 0xce, 0x47, 0xfe, 0xf3, 0xf9, 0xf3, 0xff, 0x80, 0x58, 0x75, 0xbb, 0xb6, 0x6e, 0xed, 0xed, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xe0, 0xc0, 0xe3, 0x7f, 0xce, 0xe0, 0xe3, 0x7f, 0xce, 0x61, 0x4e, 0xe0, 0xe0, 0xe1, 0xf9, 0xf3, 0xff, 0x0, 0xa0, 0xaa, 0xf5, 0xed, 0x95, 0xda, 0x7b, 0xed, 0xfb, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xb5, 0x6d, 0xdf, 0x2e, 0x6d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x40, 0x69, 0xdb, 0x76, 0xdb, 0xf4, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xa0, 0x96, 0xb6, 0xbb, 0x97, 0xee, 0xfb, 0x77, 0xbf, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x6d, 0x6d, 0xef, 0x36, 0x59, 0x6f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x50, 0xa9, 0xb5, 0xdd, 0x6d, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xa0, 0x52, 0x6a, 0xbb, 0xdb, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0xd6, 0xd6, 0x76, 0x97, 0xf4, 0xef, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0x29, 0xad, 0x6d, 0x6d, 0xab, 0xfd, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xd2, 0xda, 0xda, 0xbb, 0xde, 0xb6, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x80, 0x24, 0xb5, 0x6d, 0xdb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0xac, 0x65, 0xb7, 0xb6, 0x55, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xd9, 0xde, 0xda, 0x6d, 0xbf, 0x7b, 0xff, 0xdf, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x80, 0xd2, 0xbf, 0x6d, 0xdb, 0xfa, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0xaa, 0x6a, 0xb7, 0xb7, 0xd5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x69, 0xf7, 0x7e, 0xed, 0x7f, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0xc4, 0x5e, 0xab, 0x5b, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x92, 0xb5, 0x6d, 0xbf, 0x6d, 0xfb, 0xef, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x68, 0xfb, 0x77, 0xf5, 0xdf, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xa4, 0x4e, 0xdd, 0x5b, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0, 0x50, 0xbd, 0xbb, 0xbf, 0x6d, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x80, 0x49, 0xf3, 0xf7, 0xf6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0x89, 0x4e, 0xdd, 0x6f, 0xdb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xa6, 0xbc, 0xff, 0xdf, 0xf6, 0xff, 0x7f, 0xff, 0x77, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x6b, 0xf3, 0xed, 0xf6, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x96, 0xd7, 0xfe, 0x6f, 0xfb, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x2a, 0xed, 0xf7, 0xdb, 0xee, 0x7f, 0xf7, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0xdd, 0xba, 0x7f, 0xf7, 0x7f, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xed, 0x77, 0xff, 0xde, 0xf6, 0xed, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x5b, 0xfd, 0xdb, 0x6d, 0xbf, 0x7f, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xf7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf6, 0xee, 0xbf, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xdf, 0x76, 0xd7, 0xde, 0xee, 0xff, 0x77, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x77, 0xeb, 0xbe, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xfe, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xdf, 0xda, 0xbb, 0xf7, 0xdd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xdb, 0xb6, 0x77, 0xdf, 0xfe, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf6, 0x6d, 0xfb, 0xfd, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xdf, 0xf7, 0xbe, 0xfb, 0xdb, 0x0};
+const uint8_t image_data[4800] PROGMEM = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0x80, 0x58, 0xd0, 0xda, 0x6a, 0x5d, 0xbb, 0xff, 0x6f, 0xff, 0xef, 0xb7, 0xdd, 0x2d,
+	0xbd, 0xfb, 0xbf, 0x7d, 0xfb, 0xbe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x20, 0x24, 0x55, 0xb7, 0xef,
+	0xfe, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xeb, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0x00, 0x10, 0x48, 0xaa, 0xde, 0xfe, 0xb7, 0x6f, 0xff, 0xf7, 0x7d, 0xff, 0x76, 0xfb,
+	0xee, 0xd7, 0xff, 0xef, 0xdf, 0xf7, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x28, 0x20, 0xdd, 0xfa, 0xdd,
+	0xff, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0xfd, 0x57, 0xbf, 0xfd, 0x7f, 0xfb, 0xff, 0xbf, 0xf6, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0x00, 0x20, 0x90, 0x72, 0x6b, 0xef, 0xee, 0xfe, 0xff, 0x7e, 0xf7, 0xef, 0x6f, 0xbb,
+	0xfd, 0xff, 0xed, 0xff, 0xfe, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x10, 0x48, 0xad, 0xdd, 0xff,
+	0xff, 0xf7, 0xff, 0xff, 0xbf, 0xfd, 0xfe, 0xfe, 0x6b, 0xdb, 0xff, 0xdf, 0xf7, 0xf7, 0xbf, 0xdf,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0f, 0x00, 0x20, 0x80, 0xd4, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xb7,
+	0xdf, 0xff, 0xff, 0xfb, 0xbf, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x04, 0xa9, 0xa5, 0xef,
+	0xdb, 0xfe, 0xbd, 0xf7, 0xfb, 0xbb, 0xbf, 0xfd, 0x76, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0f, 0x00, 0x20, 0x08, 0x52, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xff, 0xfd, 0xef,
+	0xbd, 0xfb, 0xbf, 0xb7, 0xfb, 0xfd, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x48, 0x92, 0xfe, 0xf5,
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0x6f, 0xdf, 0xf7, 0xd7, 0xfb, 0xff, 0xff, 0x6f, 0x7d, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x06, 0x00, 0x00, 0x10, 0xb4, 0xa9, 0x6f, 0xf7, 0xef, 0xff, 0xff, 0xfb, 0xb7, 0xff, 0x7b,
+	0xaf, 0x7e, 0xff, 0xfb, 0xdf, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x20, 0x24, 0x69, 0x77, 0xff,
+	0xfe, 0xff, 0xdd, 0xfd, 0xfe, 0xff, 0xfb, 0xff, 0x7d, 0xfb, 0xdf, 0x6f, 0xff, 0xbe, 0xfb, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x07, 0x00, 0x00, 0x00, 0xea, 0xde, 0xed, 0xbb, 0xff, 0xff, 0xdf, 0xdf, 0xfe, 0xdf, 0xfe,
+	0xef, 0xf7, 0x7f, 0xff, 0xfb, 0x77, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x08, 0xd5, 0xed, 0x5e,
+	0xf7, 0xfd, 0xff, 0xff, 0xf7, 0x77, 0xff, 0xb7, 0x7f, 0xdf, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x01, 0x01, 0x40, 0x48, 0xba, 0x56, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
+	0xfd, 0xfd, 0xf7, 0xdf, 0xdf, 0xbf, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb4, 0x06, 0x00, 0x10, 0x6d, 0xab, 0xb5,
+	0x7a, 0xdf, 0xff, 0xff, 0xaf, 0xfd, 0x6f, 0xdf, 0xb7, 0xff, 0x7f, 0xff, 0xfb, 0x7d, 0xf7, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x3f, 0x69, 0x0d, 0x00, 0xb0, 0xf6, 0xdd, 0x6e, 0xb7, 0xfb, 0xdd, 0xf6, 0xfe, 0xbf, 0xff, 0xfb,
+	0xff, 0xdf, 0xff, 0xfb, 0xff, 0xef, 0x7e, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x4a, 0x59, 0x40, 0x48, 0xad, 0xb2, 0xf6,
+	0xed, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xfd, 0x7f, 0xfb, 0xfd, 0xff, 0x6f, 0xff, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x9f, 0xb6, 0xab, 0x80, 0xb0, 0xb6, 0xa7, 0x6d, 0x57, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff,
+	0xdf, 0xff, 0xdb, 0xff, 0xdf, 0xbd, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x49, 0x36, 0x01, 0xea, 0xdd, 0x4a, 0xbd,
+	0xbf, 0xfb, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfe, 0xbf,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x07, 0x0e, 0x06, 0x1e, 0x0f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+	0xbf, 0x24, 0x6d, 0x05, 0x6d, 0xdb, 0x5d, 0xeb, 0xed, 0xee, 0xfe, 0xdf, 0xdb, 0x7d, 0xff, 0xdf,
+	0xfe, 0x7d, 0xff, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe4,
+	0xe4, 0x3c, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x01, 0xd2, 0x02, 0xf4, 0xaf, 0xb3, 0xda,
+	0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0x7b, 0xbb, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xbf, 0x02, 0x6c, 0x03, 0xda, 0xde, 0xd6, 0xed, 0x6e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
+	0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7,
+	0xe4, 0x3c, 0xe7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x01, 0xd9, 0xc6, 0xfd, 0xdd, 0xbb, 0xb7,
+	0xff, 0xbb, 0xfd, 0xf7, 0xbf, 0xed, 0xff, 0xed, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xe4, 0x0f, 0xe6, 0x1c, 0x0e, 0x3c, 0xff, 0xff, 0xff, 0xff,
+	0xbf, 0x00, 0xa5, 0x8d, 0xf7, 0xbf, 0xb6, 0x7e, 0xdd, 0x7e, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff,
+	0xff, 0xef, 0xff, 0xf7, 0xbb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x6e, 0x61, 0xdf, 0x7b, 0xff, 0xed,
+	0xf6, 0xd7, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xbf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x6d, 0xfb,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x7f, 0x03, 0xb9, 0xeb, 0xfd, 0xdf, 0xbf, 0xff, 0x6f, 0xef, 0xfe, 0xfd, 0xbf, 0xff, 0xfb, 0xff,
+	0xff, 0xff, 0x7f, 0x7b, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xd2, 0xff, 0x7f, 0xf5, 0xb7,
+	0xdf, 0xfa, 0xfe, 0xbf, 0xff, 0xf7, 0xbf, 0xfb, 0xfb, 0xff, 0xfd, 0xef, 0xef, 0xb7, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x03, 0x6d, 0xb9, 0xbf, 0xfd, 0xff, 0xef, 0xbd, 0x6d, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff,
+	0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xda, 0xf4, 0xf7, 0xef, 0xda, 0x7e,
+	0x7f, 0xdf, 0xb7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xb7, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xee, 0x7f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x85, 0xb7, 0xda, 0xff, 0x7f, 0xf7, 0xe9, 0xf7, 0xdb, 0xfe, 0xf7, 0xff, 0xff, 0xbd, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x33, 0xfa, 0xff, 0xff, 0xab, 0xd7,
+	0xee, 0xb5, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0x7f, 0xfb, 0x7f, 0xff, 0xf7, 0xbf, 0xfe, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x67, 0x3f, 0xfd, 0xfd, 0xbd, 0x5d, 0xbe, 0xbd, 0xdf, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfd, 0x7f, 0xff, 0xdb, 0xff, 0x7e, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x9f, 0xee, 0xbf, 0xff, 0xf6, 0xea,
+	0xdb, 0xfb, 0x7b, 0x7f, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x4f, 0x9a, 0xfd, 0xff, 0xef, 0xab, 0x55, 0xff, 0xb7, 0xff, 0xef, 0xef, 0xff, 0x7f, 0xfb,
+	0xdf, 0xfd, 0xff, 0xff, 0xdf, 0xb7, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x94, 0x7f, 0xff, 0xff, 0x2d, 0xfb,
+	0xf6, 0x6f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xfb, 0x7f, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0f, 0x88, 0xf6, 0xef, 0xf6, 0xdb, 0xd6, 0xdf, 0xfd, 0xed, 0xff, 0xff, 0xff, 0xef, 0xff,
+	0xfd, 0xef, 0xff, 0xfb, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x62, 0xff, 0xff, 0x5f, 0x57, 0x29,
+	0xfd, 0xdf, 0xfe, 0xfe, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf7, 0xbf, 0xff, 0xbd, 0xfb, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0xc0, 0xff, 0xff, 0xbf, 0x9f, 0xf6, 0x6a, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
+	0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xee, 0xff, 0xff, 0xfe, 0xca,
+	0xbf, 0xeb, 0xed, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0x60, 0xff, 0xee, 0x76, 0xfb, 0xbd, 0xed, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff,
+	0xfe, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0xff, 0xed, 0x77,
+	0x35, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0xfd,
+	0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0xd0, 0xfe, 0xff, 0xdf, 0xdf, 0xee, 0xdb, 0x7a, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff,
+	0xff, 0xef, 0xbb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff,
+	0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x68, 0xf7, 0x7f, 0x7b, 0xbb, 0x5f,
+	0xf7, 0xed, 0xbf, 0xfb, 0x7f, 0xbf, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xfd, 0xbf,
+	0xff, 0xff, 0xe7, 0x0c, 0xfe, 0x0f, 0x0e, 0xe6, 0x3c, 0x0f, 0xfc, 0x0f, 0x0e, 0xe4, 0x0c, 0xfe,
+	0xff, 0x1f, 0xf0, 0xff, 0xff, 0xef, 0xf6, 0xfd, 0xae, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf7, 0xff, 0xf7, 0xed, 0xff, 0xde, 0xff, 0xff, 0xff, 0x07, 0xe4, 0xfc, 0xe7, 0xe4, 0xe4,
+	0x3c, 0xe7, 0xfc, 0xc7, 0xe7, 0xe4, 0xe4, 0xfc, 0xff, 0x0f, 0xa8, 0xff, 0xfe, 0xb7, 0xad, 0xb5,
+	0x7b, 0xfb, 0xf6, 0xff, 0xef, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xe7, 0x04, 0xfc, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0x0f, 0xe6, 0x4c, 0x06, 0xfc,
+	0xff, 0x1f, 0x74, 0xff, 0xdf, 0x5f, 0xdb, 0xee, 0xdf, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfa, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0xff, 0xe7, 0xe7, 0xe4,
+	0x3c, 0xe7, 0xfc, 0x7f, 0xe4, 0x1c, 0xe7, 0xff, 0xff, 0x0f, 0xe8, 0xfb, 0xff, 0xaf, 0x6a, 0x7f,
+	0xfb, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
+	0xff, 0xff, 0xe7, 0x0c, 0xfe, 0x0f, 0x0c, 0x0e, 0x1c, 0x0e, 0xfc, 0x07, 0x0e, 0xbc, 0x0f, 0xfe,
+	0xff, 0x0f, 0x48, 0xdf, 0xff, 0x7f, 0xb5, 0xd9, 0x6d, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xf7, 0x7f,
+	0xed, 0xf7, 0xbb, 0xef, 0xfe, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xb4, 0xff, 0xfb, 0xbf, 0xaa, 0xbb,
+	0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0f, 0xe0, 0xfd, 0x7f, 0x7f, 0x49, 0xed, 0xb6, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc0, 0xb6, 0xff, 0xbf, 0xb5, 0x76,
+	0x6f, 0xdb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdb, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x07, 0xa4, 0x7f, 0xed, 0x77, 0x4a, 0xed, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff,
+	0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x68, 0xef, 0xfb, 0xff, 0x92, 0xaa,
+	0xdb, 0xee, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xfb, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x07, 0xd4, 0xfe, 0xb6, 0xbf, 0xb5, 0x54, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+	0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0xff,
+	0xff, 0xff, 0x9f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xd4, 0xfb, 0xef, 0x5d, 0xa3, 0x75,
+	0xbd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0x7f, 0x7f, 0xf7, 0xfe, 0xfe,
+	0xff, 0xff, 0xff, 0x0f, 0x06, 0x06, 0x0e, 0x06, 0x0e, 0xfe, 0x9f, 0x07, 0x0e, 0x46, 0xfe, 0xff,
+	0xff, 0x07, 0xa8, 0xbe, 0xef, 0xef, 0x16, 0xad, 0xdb, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0xe4, 0xe4,
+	0xc4, 0xff, 0x0f, 0xe6, 0xe4, 0x04, 0xfc, 0xff, 0xff, 0x0f, 0x58, 0xbf, 0xb6, 0xbf, 0x6d, 0x52,
+	0xed, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0x04, 0xe4, 0x0f, 0xfe, 0x9f, 0xe7, 0xe7, 0xa4, 0xfc, 0xff,
+	0xff, 0x0f, 0xf0, 0x56, 0xff, 0xf6, 0xcb, 0xb4, 0x76, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf7, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe4, 0xe4, 0xe7,
+	0x7f, 0xfc, 0x9f, 0xe7, 0xe7, 0xe4, 0xfc, 0xff, 0xff, 0x1f, 0x00, 0xa8, 0xdd, 0x6f, 0x9f, 0xca,
+	0xed, 0xfe, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff,
+	0xff, 0xff, 0xff, 0x0f, 0x3e, 0xe6, 0x0c, 0xe6, 0x07, 0xfe, 0x9f, 0xe7, 0x0f, 0xe6, 0xfc, 0xff,
+	0xff, 0x0f, 0x00, 0x90, 0xfb, 0xbe, 0x75, 0x55, 0xdb, 0xef, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff,
+	0xff, 0xff, 0xfb, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x08, 0x48, 0xef, 0xfb, 0xfb, 0xaa,
+	0xb6, 0xbd, 0xef, 0xff, 0xff, 0xfd, 0xb7, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0f, 0x00, 0xa8, 0xb6, 0xb7, 0xcf, 0x55, 0xed, 0xf6, 0x7e, 0xff, 0xbf, 0xff, 0xff, 0xff,
+	0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x40, 0x7d, 0x7f, 0xbb, 0xaf,
+	0xda, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0x00, 0xd0, 0xee, 0xed, 0x7f, 0x2d, 0xdb, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf7, 0xf7, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x88, 0xba, 0xbf, 0xd5, 0x76,
+	0xb5, 0xb5, 0xff, 0xef, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1f, 0x00, 0x10, 0xf5, 0xf6, 0xbf, 0x5d, 0xda, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x7f, 0xff,
+	0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x52, 0x6e, 0x7f, 0xdb, 0xba,
+	0x75, 0xfb, 0xef, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xff,
+	0x7f, 0xe4, 0xe0, 0xc0, 0xf1, 0xe0, 0x60, 0xe0, 0xe0, 0x7f, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xff,
+	0xff, 0x1f, 0x00, 0xa4, 0xda, 0xeb, 0xbf, 0x75, 0xed, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0x7f, 0x40, 0x4e, 0xce, 0x73, 0x4e, 0x4e, 0x4e,
+	0xce, 0x7f, 0x4e, 0x4e, 0xfc, 0x79, 0xfc, 0xff, 0xff, 0x1f, 0x00, 0x4a, 0xed, 0xde, 0xb6, 0xcd,
+	0xaa, 0xfe, 0xfb, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x7f, 0x4a, 0x40, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xc0, 0x7f, 0x4e, 0xce, 0xe0, 0xf9, 0xe0, 0xff,
+	0xff, 0x1f, 0x00, 0x54, 0xbb, 0xf7, 0x6d, 0x55, 0x75, 0xbb, 0x7f, 0xf7, 0xdf, 0xfb, 0xff, 0xee,
+	0xef, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0x7e, 0xce, 0x73, 0x4e, 0x7e, 0x7e,
+	0xfe, 0x7f, 0x4e, 0xce, 0xc7, 0xc9, 0xc7, 0xf3, 0xff, 0x3f, 0x00, 0xa8, 0x76, 0x7b, 0xbf, 0x6a,
+	0xdb, 0xf7, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x57,
+	0x7f, 0xce, 0xe0, 0xc0, 0xe1, 0xe0, 0x40, 0xfe, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x63, 0xe0, 0xf3,
+	0xff, 0x3f, 0x00, 0xe2, 0xdd, 0xff, 0xdf, 0xd5, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x3f, 0x00, 0x48, 0xff, 0xb6, 0xfb, 0x4b,
+	0xb7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x7e,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x3f, 0x00, 0xfa, 0xea, 0xff, 0xff, 0xb7, 0xec, 0xfb, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xe9, 0xff, 0xff, 0xff, 0xa5,
+	0xdd, 0xde, 0xef, 0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xbf,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x7f, 0x00, 0x56, 0xbf, 0xfd, 0xff, 0xaf, 0xba, 0xf7, 0xfd, 0xff, 0xfd, 0x7d, 0xdf, 0xfe,
+	0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xfe, 0xea, 0xff, 0xdf, 0x56,
+	0xf7, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb,
+	0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xf3, 0xff, 0xff, 0xff, 0xf1, 0xe3,
+	0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xfb, 0xad, 0xaa, 0x6f, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf9,
+	0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc9, 0xff, 0x7f, 0x80, 0x3d, 0xfd, 0xff, 0xbf, 0xaf,
+	0x76, 0xfb, 0xfe, 0xff, 0xff, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdf,
+	0x7f, 0x60, 0x4e, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x7f, 0xe0, 0x71, 0xe4, 0xe0, 0xe0, 0xf3, 0xf9,
+	0xff, 0x7f, 0x80, 0x7e, 0xed, 0x77, 0x7f, 0x5b, 0xfd, 0xdd, 0x7f, 0xf7, 0x7f, 0xff, 0xff, 0xdd,
+	0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9,
+	0x7f, 0xce, 0x73, 0x40, 0x7c, 0xce, 0xf3, 0xe0, 0xff, 0xff, 0x40, 0xeb, 0xbb, 0xfd, 0xdb, 0xcd,
+	0xaa, 0xf7, 0xed, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+	0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0xca, 0x60, 0xc0, 0xf3, 0xf9,
+	0xff, 0xff, 0x00, 0x95, 0xde, 0xdf, 0xff, 0x97, 0x76, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0xf7, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0x4e, 0xce, 0xc9,
+	0x7f, 0xce, 0x73, 0xce, 0x47, 0xfe, 0xf3, 0xf9, 0xf3, 0xff, 0x80, 0x58, 0x75, 0xbb, 0xb6, 0x6e,
+	0xed, 0xed, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x7f, 0xe0, 0xc0, 0xe3, 0x7f, 0xce, 0xe0, 0xe3, 0x7f, 0xce, 0x61, 0x4e, 0xe0, 0xe0, 0xe1, 0xf9,
+	0xf3, 0xff, 0x00, 0xa0, 0xaa, 0xf5, 0xed, 0x95, 0xda, 0x7b, 0xed, 0xfb, 0xff, 0xf7, 0xff, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0xb5, 0x6d, 0xdf, 0x2e,
+	0x6d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xef,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x41, 0x40, 0x69, 0xdb, 0x76, 0xdb, 0xf4, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0x7d, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xa0, 0x96, 0xb6, 0xbb, 0x97,
+	0xee, 0xfb, 0x77, 0xbf, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x40, 0x00, 0x6d, 0x6d, 0xef, 0x36, 0x59, 0x6f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x50, 0xa9, 0xb5, 0xdd, 0x6d,
+	0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x01, 0xa0, 0x52, 0x6a, 0xbb, 0xdb, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xd6, 0xd6, 0x76, 0x97,
+	0xf4, 0xef, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x03, 0x00, 0x29, 0xad, 0x6d, 0x6d, 0xab, 0xfd, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xef,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xd2, 0xda, 0xda, 0xbb,
+	0xde, 0xb6, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x03, 0x80, 0x24, 0xb5, 0x6d, 0xdb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0xac, 0x65, 0xb7, 0xb6,
+	0x55, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0x7f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x03, 0x00, 0xd9, 0xde, 0xda, 0x6d, 0xbf, 0x7b, 0xff, 0xdf, 0xfb, 0xf7, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x80, 0xd2, 0xbf, 0x6d, 0xdb,
+	0xfa, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x07, 0x00, 0xaa, 0x6a, 0xb7, 0xb7, 0xd5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x69, 0xf7, 0x7e, 0xed,
+	0x7f, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x00, 0xc4, 0x5e, 0xab, 0x5b, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x92, 0xb5, 0x6d, 0xbf,
+	0x6d, 0xfb, 0xef, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x1f, 0x00, 0x68, 0xfb, 0x77, 0xf5, 0xdf, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xa4, 0x4e, 0xdd, 0x5b,
+	0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x3f, 0x00, 0x50, 0xbd, 0xbb, 0xbf, 0x6d, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x80, 0x49, 0xf3, 0xf7, 0xf6,
+	0xff, 0xff, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xef, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x7f, 0x00, 0x89, 0x4e, 0xdd, 0x6f, 0xdb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xa6, 0xbc, 0xff, 0xdf,
+	0xf6, 0xff, 0x7f, 0xff, 0x77, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xef,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x40, 0x6b, 0xf3, 0xed, 0xf6, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x96, 0xd7, 0xfe, 0x6f,
+	0xfb, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xa1, 0x2a, 0xed, 0xf7, 0xdb, 0xee, 0x7f, 0xf7, 0xff, 0xdf, 0xfd, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0xdd, 0xba, 0x7f, 0xf7,
+	0x7f, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xa3, 0xed, 0x77, 0xff, 0xde, 0xf6, 0xed, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0x7f,
+	0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x5b, 0xfd, 0xdb, 0x6d,
+	0xbf, 0x7f, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xf7, 0xb7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xcf, 0xf6, 0xee, 0xbf, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xdf, 0x76, 0xd7,
+	0xde, 0xee, 0xff, 0x77, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x6f, 0x77, 0xeb, 0xbe, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xdd, 0xfe, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xdf, 0xda,
+	0xbb, 0xf7, 0xdd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0x7f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x8f, 0xdb, 0xb6, 0x77, 0xdf, 0xfe, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf6, 0x6d, 0xfb,
+	0xfd, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xdf, 0xf7, 0xbe, 0xfb, 0xdb,
+};
@@ -0,0 +1,505 @@
+#!/usr/bin/env python3
+
+"""Convert 320x120 images into image_data for the firmware.
+
+Replaces png2c.py and bin2c.py. The input is a PNG (any colour type, bit
+depth and palette; read without PIL) or a .data file of one byte per pixel,
+non-zero for a pixel to draw. PNGs are converted to grey and dithered, by
+default with Floyd-Steinberg like PIL's convert("1").
+
+Every isolated pixel costs the print a stroke of its own, and error
+diffusion scatters them. The other dithers (-d) trade fidelity for fewer
+strokes: ordered (Bayer 8x8), lines (tones as horizontal lines, the cheapest to
+stroke) and a plain threshold. Despeckling (-D) fills narrow gaps in rows
+and drops isolated pixels. With auto, every choice is weighed by its visual
+error (the mean difference of the source and the bitmap, both blurred over
+5x5 pixels) plus -t times its print minutes (the 1-pixel stroke plan of
+strokes.py, under its post tool model; no print has been timed), and the
+lowest score wins; -r prints them all.
+
+Pixels are packed eight to a byte, the leftmost in bit 0, row by row: the
+whole bitmap becomes one string of '0'/'1' digits, read as a single integer
+and written out little-endian, so no Python loop runs per pixel or per bit.
+
+Output formats (-f):
+  raw      image_data[4800]: the packed bitmap, as png2c.py wrote it but
+           without its stray trailing byte
+  rle      image_rle[n]: the packed bitmap compressed with PackBits. A
+           control byte c < 128 is followed by c + 1 literal bytes; c > 128
+           repeats the next byte 257 - c times (128 is not used)
+  moves    image_moves[n]: the stroke plan of strokes.py, one operation after
+           another: 0x00 <brush> switches to a brush index, 0x01 <dx> <dy>
+           moves and 0x02 <dx> <dy> strokes (dx a little-endian int16, dy an
+           int8), 0x03 <nx> <ny> jumps with the stick (frames, signed like
+           dx and dy) and 0x04 <n> re-homes, then 0xFF
+
+The first line of every output holds a hash of the input, the options and
+this tool (and strokes.py for moves). An output whose hash still matches is
+not written again, so re-running over a directory only converts what
+changed. Given a directory, every .png and .data file in it is converted in
+parallel, each into <name>.c in the output directory.
+"""
+
+import sys, os, re, zlib, struct, hashlib, argparse
+from concurrent.futures import ProcessPoolExecutor
+
+WIDTH, HEIGHT = 320, 120
+
+FORMATS = ("raw", "rle", "moves")
+NAMES = {"raw": "image_data", "rle": "image_rle", "moves": "image_moves"}
+SOURCES = (".png", ".data")
+
+OP_BRUSH, OP_MOVE, OP_STROKE, OP_JUMP, OP_HOME, OP_END = 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF
+
+DIGITS = bytes([0x30, 0x31]) + bytes(254)   # pixel 0/1 to '0'/'1'
+PIXELS = bytes(0x30) + bytes([0, 1]) + bytes(206) # '0'/'1' to pixel 0/1
+
+DESPECKLE = [0, 1, 2, 3]                  # the despeckle levels -D auto weighs
+FPS = 1000.0 / 24                         # frames per second, as strokes.py assumes
+
+class ImageError(Exception):
+  pass
+
+# ---------------------------------------------------------------- PNG
+
+def paeth(a, b, c):
+  p = a + b - c
+  pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+  if pa <= pb and pa <= pc:
+    return a
+  return b if pb <= pc else c
+
+def unfilter(data, height, stride, bpp):
+  """The scanlines of a non-interlaced PNG, with their filters undone."""
+  rows, prior = [], bytes(stride)
+  for y in range(height):
+    start = y * (stride + 1)
+    kind, line = data[start], bytearray(data[start + 1:start + 1 + stride])
+    if kind == 1:
+      for i in range(bpp, stride):
+        line[i] = (line[i] + line[i - bpp]) & 0xFF
+    elif kind == 2:
+      line = bytearray((a + b) & 0xFF for a, b in zip(line, prior))
+    elif kind == 3:
+      for i in range(stride):
+        line[i] = (line[i] + ((line[i - bpp] if i >= bpp else 0) + prior[i]) // 2) & 0xFF
+    elif kind == 4:
+      for i in range(stride):
+        a = line[i - bpp] if i >= bpp else 0
+        c = prior[i - bpp] if i >= bpp else 0
+        line[i] = (line[i] + paeth(a, prior[i], c)) & 0xFF
+    elif kind != 0:
+      raise ImageError("unknown PNG filter {}".format(kind))
+    rows.append(bytes(line))
+    prior = line
+  return rows
+
+def samples(row, depth, count):
+  """count samples of a scanline, as bytes of 0-255 (16-bit samples keep their high byte)."""
+  if depth == 8:
+    return row[:count]
+  if depth == 16:
+    return row[0:count * 2:2]
+  # 1, 2 or 4 bits, the leftmost in the high bits: the scanline as one string
+  # of binary digits, cut into samples. Palette indices are not scaled.
+  digits = format(int.from_bytes(row, "big"), "0{}b".format(len(row) * 8))
+  return bytes(int(digits[i:i + depth], 2) for i in range(0, count * depth, depth))
+
+def read_png(data):
+  """Grey levels (0 black - 255 white) of a PNG, row by row, composited over white."""
+  if data[:8] != b"\x89PNG\r\n\x1a\n":
+    raise ImageError("not a PNG file")
+  pos, idat, palette, alpha = 8, [], None, None
+  while pos < len(data):
+    length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+    chunk = data[pos + 8:pos + 8 + length]
+    pos += 12 + length
+    if kind == b"IHDR":
+      width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+    elif kind == b"PLTE":
+      palette = chunk
+    elif kind == b"tRNS":
+      alpha = chunk
+    elif kind == b"IDAT":
+      idat.append(chunk)
+    elif kind == b"IEND":
+      break
+  if (width, height) != (WIDTH, HEIGHT):
+    raise ImageError("image must be {}px by {}px, not {}x{}".format(WIDTH, HEIGHT, width, height))
+  if interlace:
+    raise ImageError("interlaced PNGs are not supported")
+  channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(colour)
+  if channels is None:
+    raise ImageError("unknown PNG colour type {}".format(colour))
+
+  if colour == 3:
+    # Every palette entry to its grey level over white, with its alpha from tRNS.
+    lum = bytes(luminance(palette[0::3], palette[1::3], palette[2::3]))
+    lum += bytes(256 - len(lum))
+    grey_palette = over_white(lum, (alpha or b"") + b"\xff" * (256 - len(alpha or b"")))
+
+  stride = (width * channels * depth + 7) // 8
+  rows = unfilter(zlib.decompress(b"".join(idat)), height, stride, max(1, channels * depth // 8))
+  grey = bytearray()
+  for row in rows:
+    s = samples(row, depth, width * channels)
+    if colour == 3:
+      levels = s.translate(grey_palette)
+    elif colour == 0:
+      if depth < 8:
+        s = bytes(v * 255 // ((1 << depth) - 1) for v in s)
+      levels = s
+    elif colour == 4:
+      levels = over_white(s[0::2], s[1::2])
+    else:
+      lum = bytes(luminance(s[0::channels], s[1::channels], s[2::channels]))
+      levels = over_white(lum, s[3::4]) if colour == 6 else lum
+    grey += levels
+  return bytes(grey)
+
+def luminance(r, g, b):
+  # ITU-R 601-2, as PIL's convert("L").
+  return ((299 * x + 587 * y + 114 * z) // 1000 for x, y, z in zip(r, g, b))
+
+def over_white(levels, alpha):
+  return bytes((v * a + 255 * (255 - a)) // 255 for v, a in zip(levels, alpha))
+
+# ---------------------------------------------------------------- bitmap
+
+# The 8x8 Bayer matrix: the order in which an ordered dither darkens a cell.
+BAYER = [[0, 32, 8, 40, 2, 34, 10, 42], [48, 16, 56, 24, 50, 18, 58, 26],
+         [12, 44, 4, 36, 14, 46, 6, 38], [60, 28, 52, 20, 62, 30, 54, 22],
+         [3, 35, 11, 43, 1, 33, 9, 41], [51, 19, 59, 27, 49, 17, 57, 25],
+         [15, 47, 7, 39, 13, 45, 5, 37], [63, 31, 55, 23, 61, 29, 53, 21]]
+LINES = [0, 2, 1, 3]                      # the order in which a line screen darkens its rows
+
+def below(threshold):
+  """A translate table: 1 for the grey levels darker than threshold."""
+  return bytes(1 if v < threshold else 0 for v in range(256))
+
+def floyd(grey):
+  """Floyd-Steinberg to one pixel per byte, 1 for a dark pixel (PIL's convert("1"))."""
+  err = [float(v) for v in grey]
+  out = bytearray(WIDTH * HEIGHT)
+  for y in range(HEIGHT):
+    base = y * WIDTH
+    for x in range(WIDTH):
+      i = base + x
+      old = err[i]
+      new = 0.0 if old < 128 else 255.0
+      out[i] = new == 0.0
+      e = old - new
+      if e:
+        if x + 1 < WIDTH:
+          err[i + 1] += e * 7 / 16
+        if y + 1 < HEIGHT:
+          if x > 0:
+            err[i + WIDTH - 1] += e * 3 / 16
+          err[i + WIDTH] += e * 5 / 16
+          if x + 1 < WIDTH:
+            err[i + WIDTH + 1] += e * 1 / 16
+  return bytes(out)
+
+def ordered(grey):
+  """Bayer dither: the same tone always gives the same 8x8 pattern."""
+  out = bytearray(WIDTH * HEIGHT)
+  for y in range(HEIGHT):
+    for x in range(8):
+      first, last = y * WIDTH + x, (y + 1) * WIDTH
+      out[first:last:8] = grey[first:last:8].translate(below((BAYER[y % 8][x] + 0.5) * 4))
+  return bytes(out)
+
+def lines(grey):
+  """Line screen: a tone is drawn as horizontal lines, one to four rows in four."""
+  out = bytearray(WIDTH * HEIGHT)
+  for y in range(HEIGHT):
+    out[y * WIDTH:(y + 1) * WIDTH] = grey[y * WIDTH:(y + 1) * WIDTH].translate(below((LINES[y % 4] + 0.5) * 64))
+  return bytes(out)
+
+def threshold(grey):
+  return grey.translate(below(128))
+
+DITHERS = {"floyd": floyd, "ordered": ordered, "lines": lines, "threshold": threshold}
+
+def to_rows(pixels):
+  """Rows of pixel bits (bit x set = pixel x drawn), as strokes.py plans them."""
+  return [int(pixels[y * WIDTH:(y + 1) * WIDTH].translate(DIGITS)[::-1], 2) for y in range(HEIGHT)]
+
+def from_rows(rows):
+  return b"".join(format(row, "0{}b".format(WIDTH))[::-1].encode().translate(PIXELS) for row in rows)
+
+def despeckle(pixels, level):
+  """Fill the gaps of fewer than level pixels between two runs of a row, then
+  drop the pixels none of whose four neighbours is drawn. Both cost a stroke
+  of their own while adding little to the picture."""
+  if level == 0:
+    return pixels
+  import strokes
+  full = (1 << WIDTH) - 1
+  rows = to_rows(pixels)
+  for y, row in enumerate(rows):
+    spans = strokes.runs(row)
+    for (_, end), (start, _) in zip(spans, spans[1:]):
+      if start - end - 1 < level:
+        row |= strokes.span(end + 1, start - 1)
+    rows[y] = row
+  kept = []
+  for y, row in enumerate(rows):
+    near = ((row << 1) & full) | (row >> 1)
+    near |= rows[y - 1] if y > 0 else 0
+    near |= rows[y + 1] if y + 1 < HEIGHT else 0
+    kept.append(row & near)
+  return from_rows(kept)
+
+def blur(levels):
+  """A 5x5 box blur, roughly how the printed post is seen from a distance."""
+  r = 2
+  rows = []
+  for y in range(HEIGHT):
+    sums = [0]
+    for v in levels[y * WIDTH:(y + 1) * WIDTH]:
+      sums.append(sums[-1] + v)
+    rows.append([sums[min(WIDTH, x + r + 1)] - sums[max(0, x - r)] for x in range(WIDTH)])
+  out = []
+  for y in range(HEIGHT):
+    band = rows[max(0, y - r):y + r + 1]
+    out.extend(map(sum, zip(*band)))
+  return out
+
+def visual_error(grey, pixels):
+  """Mean difference of the blurred source and bitmap, in percent of full scale."""
+  printed = blur(pixels.translate(bytes([255, 0]) + bytes(254)))
+  return 100.0 * sum(abs(a - b) for a, b in zip(blur(grey), printed)) / len(printed) / 255 / 25
+
+def print_frames(pixels, invert=False):
+  """Estimated frames to print a bitmap: its best 1-pixel stroke plan (strokes.py)."""
+  import strokes
+  rows = strokes.unpack(pack(pixels, invert))
+  return min(strokes.plan(rows, [], upright).frames for upright in (False, True))
+
+class Candidate(object):
+  def __init__(self, dither, level, grey, pixels, opts):
+    self.dither, self.despeckle, self.pixels = dither, level, pixels
+    self.error = visual_error(grey, pixels)
+    self.frames = print_frames(pixels, opts.invert)
+    self.minutes = self.frames / FPS / 60
+    self.score = self.error + opts.tradeoff * self.minutes
+
+def read_grey(path):
+  """Grey levels of a PNG, or of a .data file (drawn pixels black)."""
+  data = open(path, "rb").read()
+  if path.lower().endswith(".png"):
+    return read_png(data)
+  if len(data) < WIDTH * HEIGHT:
+    raise ImageError("{} bytes, expected {}".format(len(data), WIDTH * HEIGHT))
+  # Any non-zero byte draws its pixel.
+  return data[:WIDTH * HEIGHT].translate(bytes([255]) + bytes(255))
+
+def read_pixels(path, opts=None):
+  """One byte per pixel, 1 for a pixel to draw, from a PNG or a .data file."""
+  return bitmap(path, opts or DEFAULTS)[0]
+
+def bitmap(path, opts):
+  """One byte per pixel, 1 for a pixel to draw, and the candidates that were
+  weighed for it (one unless -d auto or -D auto)."""
+  grey = read_grey(path)
+  bilevel = not path.lower().endswith(".png")
+  dithers = [opts.dither] if opts.dither != "auto" else ["threshold"] if bilevel else list(DITHERS)
+  levels = [opts.despeckle] if opts.despeckle != "auto" else DESPECKLE
+  candidates = []
+  for dither in dithers:
+    pixels = DITHERS[dither](grey)
+    for level in levels:
+      candidates.append(Candidate(dither, int(level), grey, despeckle(pixels, int(level)), opts))
+  return min(candidates, key=lambda c: c.score).pixels, candidates
+
+def pack(pixels, invert=False):
+  """image_data bytes of pixels (one byte each, 0 or 1)."""
+  bits = int(pixels.translate(DIGITS)[::-1], 2)
+  if invert:
+    bits ^= (1 << len(pixels)) - 1
+  return bits.to_bytes(len(pixels) // 8, "little")
+
+def packbits(data):
+  out = bytearray()
+  i = 0
+  while i < len(data):
+    run = 1
+    while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+      run += 1
+    if run > 1:
+      out += bytes([257 - run, data[i]])
+      i += run
+      continue
+    start = i
+    while i < len(data) and i - start < 128 and not (i + 1 < len(data) and data[i + 1] == data[i]):
+      i += 1
+    out += bytes([i - start - 1]) + data[start:i]
+  return bytes(out)
+
+def moves(data):
+  import strokes
+  ops = strokes.best_plan(strokes.unpack(data)).ops
+  out = bytearray()
+  for op in ops:
+    if op[0] == "brush":
+      out += bytes([OP_BRUSH, op[2]])
+    elif op[0] == "home":
+      out += bytes([OP_HOME, op[1]])
+    elif op[0] == "jump":
+      out += bytes([OP_JUMP]) + struct.pack("<hb", op[1], op[2])
+    else:
+      out += bytes([OP_MOVE if op[0] == "move" else OP_STROKE]) + struct.pack("<hb", op[1], op[2])
+  out.append(OP_END)
+  return bytes(out)
+
+# ---------------------------------------------------------------- output
+
+def tool_hash(fmt):
+  here = os.path.dirname(os.path.abspath(__file__))
+  h = hashlib.sha1()
+  for name in ("img2c.py", "strokes.py"):
+    with open(os.path.join(here, name), "rb") as f:
+      h.update(f.read())
+  return h.digest()
+
+def content_hash(path, opts):
+  h = hashlib.sha1(tool_hash(opts.format))
+  h.update("{} {} {} {} {} {}\n".format(opts.format, int(opts.invert), opts.name,
+                                        opts.dither, opts.despeckle, opts.tradeoff).encode())
+  with open(path, "rb") as f:
+    h.update(f.read())
+  return h.hexdigest()
+
+def stored_hash(out):
+  try:
+    with open(out) as f:
+      match = re.search(r"hash ([0-9a-f]{40})", f.readline())
+  except IOError:
+    return None
+  return match.group(1) if match else None
+
+def render(source, opts, data, digest):
+  lines = ["/* Generated by img2c.py from {} ({}, hash {}). Do not edit. */".format(os.path.basename(source), opts.format, digest),
+           "", "#include <stdint.h>", "#include <avr/pgmspace.h>", "",
+           "const uint8_t {}[{}] PROGMEM = {{".format(opts.name, len(data))]
+  for i in range(0, len(data), 16):
+    lines.append("\t" + " ".join("0x{:02x},".format(b) for b in data[i:i + 16]))
+  lines += ["};", ""]
+  return "\n".join(lines)
+
+def report(candidates):
+  """The candidates weighed for an image, the chosen one marked."""
+  best = min(candidates, key=lambda c: c.score)
+  lines = ["  {:<10} {:>9} {:>7} {:>8} {:>7} {:>7}".format("dither", "despeckle", "error", "frames", "min", "score")]
+  for c in candidates:
+    lines.append("{} {:<10} {:>9} {:>6.2f}% {:>8} {:>7.1f} {:>7.2f}".format(
+      "*" if c is best else " ", c.dither, c.despeckle, c.error, c.frames, c.minutes, c.score))
+  return "\n".join(lines)
+
+def convert(job):
+  """Convert one image. Returns (source, output, status, bytes, report)."""
+  source, out, opts = job
+  try:
+    digest = content_hash(source, opts)
+    if not opts.force and not opts.report and stored_hash(out) == digest:
+      return source, out, "unchanged", None, None
+    pixels, candidates = bitmap(source, opts)
+    data = pack(pixels, opts.invert)
+    if opts.format == "rle":
+      data = packbits(data)
+    elif opts.format == "moves":
+      data = moves(data)
+    if opts.force or stored_hash(out) != digest:
+      with open(out, "w") as f:
+        f.write(render(source, opts, data, digest))
+    return source, out, "converted", len(data), report(candidates) if opts.report else None
+  except (IOError, ImageError, zlib.error, struct.error) as e:
+    return source, out, "error: {}".format(e), None, None
+
+def write_png(out, grey):
+  """Write grey levels (one byte per pixel, row by row) as an 8-bit greyscale PNG."""
+  raw = b"".join(b"\x00" + grey[y * WIDTH:(y + 1) * WIDTH] for y in range(HEIGHT))
+  def chunk(kind, body):
+    return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body) & 0xFFFFFFFF)
+  with open(out, "wb") as f:
+    f.write(b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", struct.pack(">IIBBBBB", WIDTH, HEIGHT, 8, 0, 0, 0, 0))
+            + chunk(b"IDAT", zlib.compress(raw, 9)) + chunk(b"IEND", b""))
+
+def save_bilevel(source, out, opts):
+  """Write the bitmap as a PNG, dark pixels black."""
+  write_png(out, bitmap(source, opts)[0].translate(bytes([255, 0]) + bytes(254)))
+
+def despeckle_level(text):
+  if text == "auto":
+    return text
+  level = int(text)
+  if level < 0:
+    raise argparse.ArgumentTypeError("the despeckle level must be 0 or more")
+  return level
+
+def parser():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("source", help="a PNG, a .data file or a directory of them")
+  parser.add_argument("-o", "--output", help="output file, or directory for a directory (default image.c, or the source directory)")
+  parser.add_argument("-f", "--format", choices=FORMATS, default="raw", help="output format (default raw)")
+  parser.add_argument("-i", "--invert", action="store_true", help="invert the colormap: draw the light pixels")
+  parser.add_argument("-n", "--name", help="array name (default image_data, image_rle or image_moves)")
+  parser.add_argument("-d", "--dither", choices=sorted(DITHERS) + ["auto"], default="floyd",
+                      help="how a PNG is made bilevel (default floyd); auto weighs them all with -t")
+  parser.add_argument("-D", "--despeckle", type=despeckle_level, default=0,
+                      help="fill row gaps narrower than this and drop isolated pixels (default 0: off); auto weighs 0-3")
+  parser.add_argument("-t", "--tradeoff", type=float, default=1.0,
+                      help="with auto, the visual error (percent) worth one minute of printing (default 1)")
+  parser.add_argument("-r", "--report", action="store_true", help="print the error and modelled print time of every candidate")
+  parser.add_argument("-s", "--save-bilevel", action="store_true", help="save the bitmap as bilevel_<name>.png instead")
+  parser.add_argument("-F", "--force", action="store_true", help="convert even when the hash matches")
+  parser.add_argument("-j", "--jobs", type=int, help="parallel conversions (default: one per CPU)")
+  return parser
+
+DEFAULTS = parser().parse_args(["-"])
+
+def main(argv):
+  args = parser().parse_args(argv)
+  args.name = args.name or NAMES[args.format]
+
+  if os.path.isdir(args.source):
+    outdir = args.output or args.source
+    os.makedirs(outdir, exist_ok=True)
+    sources = sorted(f for f in os.listdir(args.source) if f.lower().endswith(SOURCES))
+    jobs = [(os.path.join(args.source, f), os.path.join(outdir, os.path.splitext(f)[0] + ".c"), args) for f in sources]
+  else:
+    jobs = [(args.source, args.output or "image.c", args)]
+
+  if args.save_bilevel:
+    for source, _, _ in jobs:
+      out = os.path.join(os.path.dirname(source), "bilevel_" + os.path.splitext(os.path.basename(source))[0] + ".png")
+      try:
+        save_bilevel(source, out, args)
+      except (IOError, ImageError, zlib.error, struct.error) as e:
+        print("img2c: {}: {}".format(source, e))
+        return 2
+      print("Bilevel version of {} saved as {}".format(source, out))
+    return 0
+
+  if len(jobs) > 1:
+    with ProcessPoolExecutor(args.jobs) as pool:
+      results = list(pool.map(convert, jobs))
+  else:
+    results = [convert(job) for job in jobs]
+
+  failed = 0
+  for source, out, status, size, table in results:
+    if status == "converted":
+      print("{} converted{} to {} ({} bytes)".format(source, " with inverted colormap" if args.invert else "", out, size))
+    elif status == "unchanged":
+      print("{} unchanged, {} kept".format(source, out))
+    else:
+      print("img2c: {}: {}".format(source, status[len("error: "):]))
+      failed += 1
+    if table:
+      print(table)
+  return 1 if failed else 0
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))
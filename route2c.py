@@ -0,0 +1,790 @@
+#!/usr/bin/env python3
+
+"""Compile a route file (route.txt) into the flash tables played by the firmware.
+
+The output replaces the hand-written arrays of Step.c: every phase becomes a
+packed PROGMEM table plus an accessor with the same signature as before, so
+Joystick.c keeps calling GoToAlterna(bufindex) and friends.
+
+Optimisations:
+  - adjacent identical commands are merged (NOTHING waits in particular),
+  - zero-length steps (empty repeats, uses and conditionals) are folded away,
+  - a repeat at the top of a phase is stored once with its count, unless
+    where it lands in the table would depend on a conditional,
+  - identical tables and shared tails are stored once, and mirrored phases
+    share the table of the phase they mirror,
+  - each table uses the narrowest entry encoding that holds its durations
+    (1, 2 or 3 bytes per entry).
+
+These save flash and SRAM, not time: every frame reads its entry from
+flash and unpacks it (and maps its index into a stored repeat), where the
+hand-written arrays were read from SRAM.
+`use` is expanded in place, so it shares nothing beyond the tails above.
+
+Every phase carries its echo count: how many times each of its frames is
+sent again after the first poll. Waits that cover the game's loading keep
+the default, while menu taps can use echo 0 and last only a few polls. The
+count can depend on Config.h (`echo 0 if FAST_MENUS`) like the conditionals.
+
+The wait that ends a phase can accept inputs early (`NOTHING 1200 accepts
+41 { ZL }`): in its last frames the firmware already plays the next step's
+first input when it is one of those, so the input overlaps the wait
+instead of following it. Accepts() tells the firmware each window.
+
+With -p the route is instead compiled into a program for the controller's
+EEPROM (Macro.h), which gadget/reader -u uploads over USB. The program
+carries the tables of the phases given with -t (all of them by default),
+and the firmware plays them instead of its flash tables from its next boot.
+It is only taken by a firmware compiled from a route with the same tables
+(ROUTE_SIGNATURE): the waits, inputs and echo counts can change, the
+phases cannot. The conditionals are decided with the values in Config.h,
+or -D NAME=VALUE where the controller was built with others.
+"""
+
+import sys, os, re, getopt, struct
+
+BUTTON_BITS = 5                           # Buttons_t lives in the low bits of an entry
+MAX_D8      = (1 << (8 - BUTTON_BITS)) - 1
+MAX_D16     = (1 << (16 - BUTTON_BITS)) - 1
+MAX_D24     = 0xFFFF
+MAX_ECHO    = 0xFF
+DEFAULT_ECHO = 2                          # Joystick.c: ECHOES
+HAND_WRITTEN_ENTRY = 4                    # sizeof(command) on AVR: 2-byte enum + uint16_t
+
+TRACKS = ["lstick", "rstick", "hat", "buttons"]
+TRACK_ENUM = {"lstick": "TRACK_LSTICK", "rstick": "TRACK_RSTICK", "hat": "TRACK_HAT", "buttons": "TRACK_BUTTONS"}
+MIRROR = {"LEFT": "RIGHT", "RIGHT": "LEFT", "L_LEFT": "L_RIGHT", "L_RIGHT": "L_LEFT", "R_LEFT": "R_RIGHT", "R_RIGHT": "R_LEFT"}
+
+class RouteError(Exception):
+  pass
+
+def crc16(data, crc=0xFFFF):
+  """CRC-16/CCITT as avr-libc's _crc_ccitt_update() computes it."""
+  for byte in bytearray(data):
+    byte ^= crc & 0xFF
+    byte = (byte ^ (byte << 4)) & 0xFF
+    crc = ((byte << 8) | (crc >> 8)) ^ (byte >> 4) ^ (byte << 3)
+  return crc & 0xFFFF
+
+class Cmd(object):
+  def __init__(self, button, duration, line, accepts=None):
+    self.button, self.duration, self.line = button, duration, line
+    self.accepts = accepts                # (frames, [buttons]) of a wait that takes inputs early
+
+class Cond(object):
+  def __init__(self, expr, then, otherwise, line):
+    self.expr, self.then, self.otherwise, self.line = expr, then, otherwise, line
+
+class Rep(object):
+  def __init__(self, count, body, line):
+    self.count, self.body, self.line = count, body, line
+
+class Phase(object):
+  def __init__(self, name, line):
+    self.name, self.line = name, line
+    self.end = 0
+    self.echo = DEFAULT_ECHO
+    self.body = None                      # single-track phase
+    self.tracks = None                    # timeline phase: {track: body}
+    # echo is a number, or (expr, echo if true, echo otherwise, line) for `echo N if expr`
+    self.mirror_of = None                 # mirrored alias
+
+# ---------------------------------------------------------------- parsing
+
+def read_buttons(step_h):
+  text = open(step_h).read()
+  match = re.search(r"typedef enum \{([^}]*)\} Buttons_t;", text)
+  if not match:
+    raise RouteError("cannot find Buttons_t in " + step_h)
+  names = [re.sub(r"//.*", "", l).strip().rstrip(",") for l in match.group(1).split("\n")]
+  return [n for n in names if n]
+
+def read_config(config_h):
+  return set(re.findall(r"#define\s+(\w+)", open(config_h).read()))
+
+def read_values(header):
+  """The #defines of a header that are plain numbers."""
+  return dict((name, int(value, 0)) for name, value in
+              re.findall(r"#define\s+(\w+)\s+(0x[0-9A-Fa-f]+|\d+)\b", open(header).read()))
+
+def tokenize(text):
+  tokens = []
+  for number, line in enumerate(text.split("\n"), 1):
+    line = line.split("//")[0]
+    for token in re.findall(r"==|!=|<=|>=|[{}=]|[^\s{}=]+", line):
+      tokens.append((token, number))
+  return tokens
+
+class Parser(object):
+  def __init__(self, tokens, buttons, config):
+    self.tokens, self.pos = tokens, 0
+    self.buttons, self.config = buttons, config
+
+  def peek(self):
+    return self.tokens[self.pos][0] if self.pos < len(self.tokens) else None
+
+  def line(self):
+    return self.tokens[min(self.pos, len(self.tokens) - 1)][1] if self.tokens else 0
+
+  def take(self, expected=None):
+    if self.pos >= len(self.tokens):
+      raise RouteError("unexpected end of file")
+    token, line = self.tokens[self.pos]
+    if expected is not None and token != expected:
+      raise RouteError("line {}: expected '{}', found '{}'".format(line, expected, token))
+    self.pos += 1
+    return token
+
+  def number(self):
+    line, token = self.line(), self.take()
+    if not token.isdigit():
+      raise RouteError("line {}: expected a number, found '{}'".format(line, token))
+    return int(token)
+
+  def phases(self):
+    phases = []
+    while self.peek() is not None:
+      line = self.line()
+      self.take("phase")
+      phase = Phase(self.take(), line)
+      if self.peek() == "=":
+        self.take("=")
+        self.take("mirror")
+        phase.mirror_of = self.take()
+      else:
+        while self.peek() in ("end", "echo"):
+          attribute = self.take()
+          if attribute == "end":
+            phase.end = self.number()
+          else:
+            echo = self.number()
+            if echo > MAX_ECHO:
+              raise RouteError("line {}: echo {} is too large".format(phase.line, echo))
+            if self.peek() == "if":
+              self.take("if")
+              phase.echo = (self.condition(("{", "end", "echo")), echo, phase.echo, phase.line)
+            else:
+              phase.echo = echo
+        self.take("{")
+        if self.peek() == "track":
+          phase.tracks = {}
+          while self.peek() == "track":
+            self.take("track")
+            name = self.take()
+            if name not in TRACKS:
+              raise RouteError("line {}: unknown track '{}'".format(self.line(), name))
+            self.take("{")
+            phase.tracks[name] = self.block()
+          self.take("}")
+        else:
+          phase.body = self.block()
+      phases.append(phase)
+    return phases
+
+  def condition(self, stops):
+    line, expr = self.line(), []
+    while self.peek() not in stops:
+      name = self.take()
+      if re.match(r"[A-Za-z_]\w*$", name) and name not in self.config:
+        raise RouteError("line {}: '{}' is not defined in Config.h".format(line, name))
+      expr.append(name)
+    return " ".join(expr)
+
+  def block(self):
+    items = []
+    while self.peek() != "}":
+      line, token = self.line(), self.take()
+      if token == "repeat":
+        count = self.number()
+        self.take("{")
+        items.append(("repeat", count, self.block(), line))
+      elif token == "use":
+        items.append(("use", self.take(), line))
+      elif token == "if":
+        expr = self.condition(("{",))
+        self.take("{")
+        then, otherwise = self.block(), []
+        if self.peek() == "else":
+          self.take("else")
+          self.take("{")
+          otherwise = self.block()
+        items.append(("if", expr, then, otherwise, line))
+      elif token in self.buttons:
+        if token in ("END", "MERGED"):
+          raise RouteError("line {}: {} is generated by the compiler".format(line, token))
+        duration, accepts = self.number(), None
+        if self.peek() == "accepts":
+          self.take("accepts")
+          frames = self.number()
+          if token != "NOTHING" or frames == 0 or frames > duration + 1:
+            raise RouteError("line {}: only the last {} frames of a NOTHING can accept inputs".format(line, duration + 1))
+          self.take("{")
+          inputs = []
+          while self.peek() != "}":
+            name = self.take()
+            if name not in self.buttons or name in ("END", "MERGED", "NOTHING"):
+              raise RouteError("line {}: '{}' cannot be accepted early".format(line, name))
+            inputs.append(name)
+          self.take("}")
+          accepts = (frames, inputs)
+        items.append(("cmd", token, duration, line, accepts))
+      else:
+        raise RouteError("line {}: unknown command '{}'".format(line, token))
+    self.take("}")
+    return items
+
+# ---------------------------------------------------------- expansion
+
+def expand(items, phases, stack, keep=False):
+  """Expand uses and repeats; with keep, a repeat at the top stays a Rep stored once."""
+  out = []
+  for item in items:
+    if item[0] == "cmd":
+      out.append(Cmd(item[1], item[2], item[3], item[4]))
+    elif item[0] == "repeat" and keep and item[1] > 1:
+      out.append(Rep(item[1], expand(item[2], phases, stack), item[3]))
+    elif item[0] == "repeat":
+      for _ in range(item[1]):
+        out.extend(expand(item[2], phases, stack))
+    elif item[0] == "use":
+      name = item[1]
+      if name not in phases or phases[name].body is None:
+        raise RouteError("line {}: 'use {}' needs a single-track phase".format(item[2], name))
+      if name in stack:
+        raise RouteError("line {}: phase {} uses itself".format(item[2], name))
+      out.extend(expand(phases[name].body, phases, stack + [name]))
+    elif item[0] == "if":
+      out.append(Cond(item[1], expand(item[2], phases, stack), expand(item[3], phases, stack), item[4]))
+  return out
+
+def flatten(items):
+  """The items with every Rep written out in full."""
+  out = []
+  for item in items:
+    if isinstance(item, Rep):
+      out.extend(flatten(item.body) * item.count)
+    elif isinstance(item, Cond):
+      out.append(Cond(item.expr, flatten(item.then), flatten(item.otherwise), item.line))
+    else:
+      out.append(item)
+  return out
+
+def fixed_entries(items):
+  """The entries the items take whichever way the conditionals go, or None."""
+  total = 0
+  for item in items:
+    if isinstance(item, Cond):
+      then, otherwise = fixed_entries(item.then), fixed_entries(item.otherwise)
+      if then is None or then != otherwise:
+        return None
+      total += then
+    elif isinstance(item, Rep):
+      body = fixed_entries(item.body)
+      if body is None:
+        return None
+      total += body
+    else:
+      total += 1
+  return total
+
+def optimise(items):
+  out = []
+  for item in items:
+    if isinstance(item, Rep):
+      body = optimise(item.body)
+      if not body:
+        continue                          # zero-length step
+      if len(body) == 1 and isinstance(body[0], Cmd) and not body[0].accepts:
+        item = Cmd(body[0].button, (body[0].duration + 1) * item.count - 1, body[0].line)
+      elif fixed_entries(out) is None or fixed_entries(body) is None or list(windows(body)):
+        # Where the repeat lands in the table would depend on Config.h: write it out.
+        out.extend(optimise(flatten([Rep(item.count, body, item.line)])))
+        continue
+      else:
+        out.append(Rep(item.count, body, item.line))
+        continue
+    if isinstance(item, Cond):
+      item.then, item.otherwise = optimise(item.then), optimise(item.otherwise)
+      if not item.then and not item.otherwise:
+        continue                          # zero-length step
+    elif out and isinstance(out[-1], Cmd) and out[-1].button == item.button:
+      # Two identical commands in a row send the same reports as one longer command.
+      out[-1] = Cmd(item.button, out[-1].duration + item.duration + 1, out[-1].line, item.accepts)
+      continue
+    out.append(item)
+  return out
+
+def windows(items):
+  for item in items:
+    if isinstance(item, Cond):
+      for cmd in windows(item.then + item.otherwise):
+        yield cmd
+    elif isinstance(item, Rep):
+      for cmd in windows(item.body):
+        yield cmd
+    elif item.accepts:
+      yield item
+
+def window(phase, items):
+  """The accepts window of a phase: only its final wait may take the next step's inputs early.
+
+  A phase that ends in a conditional has a window (or none) for each branch,
+  returned as a Cond of windows."""
+  found = list(windows(items))
+  if not found:
+    return None
+  last = items[-1]
+  if isinstance(last, Cond) and not phase.end and len(list(windows(last.then + last.otherwise))) == len(found):
+    return Cond(last.expr, window(phase, last.then), window(phase, last.otherwise), last.line)
+  if len(found) > 1 or found[0] is not last or phase.end:
+    raise RouteError("line {}: only the final wait of a phase without end can accept inputs".format(found[0].line))
+  return found[0].accepts
+
+def echo_c(echo):
+  """A phase's echo count as the firmware reads it."""
+  if isinstance(echo, tuple):
+    return "({} ? {} : {})".format(echo[0], echo[1], echo_c(echo[2]))
+  return str(echo)
+
+def echo_value(echo, values):
+  """A phase's echo count as it is with these Config.h values."""
+  if isinstance(echo, tuple):
+    return echo[1] if evaluate(echo[0], values, echo[3]) else echo_value(echo[2], values)
+  return echo
+
+def count_entries(items):
+  """The entries the items take in a table (a Rep's body once)."""
+  total = 0
+  for item in items:
+    if isinstance(item, Cond):
+      total += count_entries(item.then) + count_entries(item.otherwise)
+    elif isinstance(item, Rep):
+      total += count_entries(item.body)
+    else:
+      total += 1
+  return total
+
+def durations(items):
+  for item in items:
+    if isinstance(item, Cond):
+      for d in durations(item.then + item.otherwise):
+        yield d
+    elif isinstance(item, Rep):
+      for d in durations(item.body):
+        yield d
+    else:
+      yield item.duration
+
+def split(items, limit):
+  """Split holds longer than the encoding allows into back-to-back commands."""
+  out = []
+  for item in items:
+    if isinstance(item, Cond):
+      out.append(Cond(item.expr, split(item.then, limit), split(item.otherwise, limit), item.line))
+      continue
+    if isinstance(item, Rep):
+      out.append(Rep(item.count, split(item.body, limit), item.line))
+      continue
+    frames = item.duration + 1
+    while frames > limit + 1:
+      out.append(Cmd(item.button, limit, item.line))
+      frames -= limit + 1
+    if item.accepts and item.accepts[0] > frames:
+      raise RouteError("line {}: the window of {} frames is longer than the last table entry".format(item.line, item.accepts[0]))
+    out.append(Cmd(item.button, frames - 1, item.line, item.accepts))
+  return out
+
+# ------------------------------------------------------------- tables
+
+class Table(object):
+  def __init__(self, name, items, end, echo):
+    self.name, self.end, self.echo = name, end, echo
+    self.source = items                   # before splitting, for the EEPROM program
+    self.conditional = any(isinstance(i, Cond) for i in flatten(items))
+    longest = max(list(durations(items)) + [end])
+    if longest <= MAX_D8:
+      self.width, self.items = 1, items
+    else:
+      split16 = split(items, MAX_D16)
+      if end <= MAX_D16 and (count_entries(split16) + 1) * 2 <= (count_entries(items) + 1) * 3:
+        self.width, self.items = 2, split16
+      elif end <= MAX_D24:
+        self.width, self.items = 3, split(items, MAX_D24)
+      else:
+        raise RouteError("{}: END duration {} is too long".format(name, end))
+    if fixed_entries(self.items) is None:
+      self.items = flatten(self.items)    # splitting moved a repeat differently on each side
+    self.count = count_entries(self.items) + 1
+    self.repeats = list(repeats(self.items))
+    self.base, self.offset = self, 0       # storage shared with another table
+
+  def key(self):
+    return [(i.button, i.duration) for i in flatten(self.items)] + [("END", self.end)]
+
+  def id(self):
+    """The table's number in an EEPROM program (Route.h: Table_t)."""
+    return "TABLE_" + re.sub(r"_table$", "", self.name)
+
+  def ctype(self):
+    return {1: "uint8_t", 2: "uint16_t", 3: "wide_command"}[self.width]
+
+  def ref(self):
+    if self.base is self:
+      return self.name
+    return "&{}[{}]".format(self.base.name, self.offset)
+
+  def count_expr(self):
+    if self.conditional or self.repeats:
+      return "sizeof({0}) / sizeof({0}[0])".format(self.name)
+    return str(self.count)
+
+  def read(self, echo):
+    stored = "index"
+    for at, length, count in self.repeats:
+      stored = "Repeat({}, {}, {}, {})".format(stored, at, length, count)
+    at = "STEP_AT({}, {}, {})".format(self.ref(), self.count_expr(), stored)
+    if self.width == 1:
+      flash = "Decode8(pgm_read_byte({}), {})".format(at, echo)
+    elif self.width == 2:
+      flash = "Decode16(pgm_read_word({}), {})".format(at, echo)
+    else:
+      flash = "DecodeWide({}, {})".format(at, echo)
+    return "MacroHas({0}) ? MacroAt({0}, index) : {1}".format(self.id(), flash)
+
+def repeats(items):
+  """(where it starts, entries, count) of each Rep, in the step numbering after the ones before it."""
+  at = 0
+  for item in items:
+    if isinstance(item, Rep):
+      length = fixed_entries(item.body)
+      yield at, length, item.count
+      at += length
+    else:
+      at += fixed_entries([item])
+
+def share(tables):
+  """Store identical tables and shared tails only once."""
+  placed = []
+  for table in sorted(tables, key=lambda t: -t.count):
+    if not table.conditional and not table.repeats:
+      key = table.key()
+      for other in placed:
+        other_key = other.key()
+        if other.width == table.width and other_key[len(other_key) - len(key):] == key:
+          table.base, table.offset = other, other.count - len(key)
+          break
+    if table.base is table and not table.conditional and not table.repeats:
+      placed.append(table)
+
+def entry(table, button, duration):
+  if table.width == 3:
+    return "{{ {:<8}, {:>5} }}".format(button, duration)
+  return "{:<8} | ({:>4}u << {})".format(button, duration, BUTTON_BITS)
+
+def emit_items(table, items, lines, depth=0):
+  for item in items:
+    if isinstance(item, Cond):
+      lines.append("#if " + item.expr)
+      emit_items(table, item.then, lines, depth + 1)
+      if item.otherwise:
+        lines.append("#else")
+        emit_items(table, item.otherwise, lines, depth + 1)
+      lines.append("#endif")
+    elif isinstance(item, Rep):
+      lines.append("\t/* 次の {} ステップを {} 回繰り返す (route.txt:{}) */".format(fixed_entries(item.body), item.count, item.line))
+      emit_items(table, item.body, lines, depth)
+    else:
+      lines.append("\t{}, // route.txt:{}".format(entry(table, item.button, item.duration), item.line))
+
+def emit_window(accepts, lines):
+  if isinstance(accepts, Cond):
+    lines.append("#if " + accepts.expr)
+    emit_window(accepts.then, lines)
+    lines.append("#else")
+    emit_window(accepts.otherwise, lines)
+    lines.append("#endif")
+  elif accepts is None:
+    lines.append("\t\treturn 0;")
+  else:
+    frames, inputs = accepts
+    lines.append("\t\tswitch (button) {")
+    lines += ["\t\t\tcase {}:".format(name) for name in inputs]
+    lines += ["\t\t\t\treturn {};".format(frames), "\t\t\tdefault:", "\t\t\t\treturn 0;", "\t\t}"]
+
+# ------------------------------------------------------------ program
+
+def evaluate(expr, values, line):
+  """Decide a conditional as the preprocessor would with these values."""
+  def value(match):
+    if match.group(0) not in values:
+      raise RouteError("line {}: '{}' has no value in Config.h (use -D)".format(line, match.group(0)))
+    return str(values[match.group(0)])
+  python = re.sub(r"[A-Za-z_]\w*", value, expr)
+  python = re.sub(r"!(?!=)", " not ", python.replace("&&", " and ").replace("||", " or "))
+  try:
+    return bool(eval(python, {"__builtins__": {}}))
+  except SyntaxError:
+    raise RouteError("line {}: cannot decide '{}'".format(line, expr))
+
+def decide(items, values):
+  out = []
+  for item in items:
+    if isinstance(item, Cond):
+      out.extend(decide(item.then if evaluate(item.expr, values, item.line) else item.otherwise, values))
+    elif isinstance(item, Rep):
+      out.extend(decide(item.body, values) * item.count)
+    else:
+      out.append(item)
+  return out
+
+class Program(object):
+  """The tables of a route as a program for the controller's EEPROM (Macro.h)."""
+  def __init__(self, tables, owners, signature, buttons):
+    self.tables, self.owners, self.signature = tables, owners, signature
+    self.buttons = dict((name, number) for number, name in enumerate(buttons))
+
+  def build(self, phases, values):
+    """The program bytes: the header, then a record for each table of these phases (all when empty)."""
+    chosen = set()
+    for name in phases or self.owners:
+      if name not in self.owners:
+        raise RouteError("no phase named '{}'".format(name))
+      chosen.update(self.owners[name])
+
+    records, count = b"", 0
+    for number, table in enumerate(self.tables):
+      if table not in chosen:
+        continue
+      if table.end > MAX_D16:
+        raise RouteError("{}: END duration {} is too long for a program".format(table.name, table.end))
+      items = split(decide(table.source, values), MAX_D16)
+      entries = [(i.button, i.duration) for i in items] + [("END", table.end)]
+      if len(entries) > 0xFF:
+        raise RouteError("{}: {} entries are too many for a program".format(table.name, len(entries)))
+      records += struct.pack("<BBB", number, echo_value(table.echo, values), len(entries))
+      records += b"".join(struct.pack("<H", self.buttons[b] | d << BUTTON_BITS) for b, d in entries)
+      count += 1
+
+    header = struct.pack("<HHHHBB", values["MACRO_MAGIC"], self.signature, len(records), crc16(records),
+                         values["MACRO_VERSION"], count)
+    program = header + records
+    if len(program) > values["MACRO_SIZE"]:
+      raise RouteError("the program needs {} bytes, MACRO_SIZE is {} (choose fewer phases with -t)".format(
+        len(program), values["MACRO_SIZE"]))
+    return program, count
+
+# ------------------------------------------------------------- output
+
+HEADER = """/* ---------------------------------------------- */
+/* スプラトゥーン3 オルタナのドローン起動を自動化 */
+/* 									by Dettsu3420 */
+/* ---------------------------------------------- */
+/* {source} から route2c.py で生成（直接編集しない） */
+"""
+
+def compile_route(source, step_h, config_h):
+  buttons = read_buttons(step_h)
+  if len(buttons) > (1 << BUTTON_BITS):
+    raise RouteError("Buttons_t has more than {} values".format(1 << BUTTON_BITS))
+  parsed = Parser(tokenize(open(source).read()), buttons, read_config(config_h)).phases()
+
+  phases = {}
+  for phase in parsed:
+    if phase.name in phases:
+      raise RouteError("line {}: phase {} is defined twice".format(phase.line, phase.name))
+    phases[phase.name] = phase
+
+  tables, accessors, naive = [], [], 0
+  accepting = []
+  for phase in parsed:
+    if phase.mirror_of:
+      base = phases.get(phase.mirror_of)
+      if base is None or base.body is None:
+        raise RouteError("line {}: can only mirror a single-track phase".format(phase.line))
+      phase.echo = base.echo              # a mirror plays at the pace of its phase
+      naive += (count_entries(expand(base.body, phases, [base.name])) + 1) * HAND_WRITTEN_ENTRY
+      accessors.append((phase, None))
+    elif phase.tracks is not None:
+      track_tables = {}
+      for track in TRACKS:
+        if track in phase.tracks:
+          items = expand(phase.tracks[track], phases, [phase.name])
+          if list(windows(items)):
+            raise RouteError("line {}: a timeline cannot accept inputs early".format(phase.line))
+          naive += (count_entries(items) + 1) * HAND_WRITTEN_ENTRY
+          track_tables[track] = Table("{}_{}".format(phase.name, track), optimise(items), 0, phase.echo)
+          tables.append(track_tables[track])
+      accessors.append((phase, track_tables))
+    else:
+      items = expand(phase.body, phases, [phase.name], keep=True)
+      naive += (count_entries(flatten(items)) + 1) * HAND_WRITTEN_ENTRY
+      optimised = optimise(items)
+      if window(phase, optimised):
+        accepting.append((phase, window(phase, optimised)))
+      table = Table(phase.name + "_table", optimised, phase.end, phase.echo)
+      tables.append(table)
+      accessors.append((phase, table))
+  share(tables)
+
+  own = dict((phase.name, table) for phase, table in accessors if isinstance(table, Table))
+  # A program (-p) is only taken by a firmware with the same table numbers and buttons.
+  route_signature = crc16("\n".join([t.id() for t in tables] + buttons).encode())
+  widths = set(t.width for t in tables)
+  conditional = any(t.conditional for t in tables) or any(isinstance(phase.echo, tuple) for phase in parsed)
+
+  out = [HEADER.format(source=os.path.basename(source)), '#include <avr/pgmspace.h>', '', '#include "Step.h"', '#include "Macro.h"']
+  if conditional:
+    out.append('#include "Config.h"')
+  out.append("")
+  out.append("/* テーブルの1エントリ: 下位{}ビットが Buttons_t、残りのビットが duration */".format(BUTTON_BITS))
+  if 1 in widths:
+    out += ["static inline command Decode8(uint8_t entry, uint8_t echo) {",
+            "\tcommand cmd = {{ entry & 0x{:02X}, entry >> {}, echo }};".format((1 << BUTTON_BITS) - 1, BUTTON_BITS),
+            "\treturn cmd;", "}", ""]
+  if 2 in widths:
+    out += ["static inline command Decode16(uint16_t entry, uint8_t echo) {",
+            "\tcommand cmd = {{ entry & 0x{:02X}, entry >> {}, echo }};".format((1 << BUTTON_BITS) - 1, BUTTON_BITS),
+            "\treturn cmd;", "}", ""]
+  if 3 in widths:
+    out += ["/* duration が長いテーブル用: Buttons_t と duration を別々に格納 */",
+            "typedef struct {", "\tuint8_t  button;", "\tuint16_t duration;", "} wide_command;", "",
+            "static inline command DecodeWide(const wide_command* entry, uint8_t echo) {",
+            "\tcommand cmd = { pgm_read_byte(&entry->button), pgm_read_word(&entry->duration), echo };",
+            "\treturn cmd;", "}", ""]
+  if any(t.repeats for t in tables):
+    out += ["/* repeat を1回分だけ格納したテーブルで、ステップの index を格納した位置に直す */",
+            "static inline int Repeat(int index, int at, int length, int count) {",
+            "\tif (index < at) return index;",
+            "\tif (index < at + length * count) return at + (index - at) % length;",
+            "\treturn index - length * (count - 1);", "}", ""]
+  if any(phase.mirror_of for phase, _ in accessors):
+    out += ["/* 左右を反転したコマンドを返す */", "static command Mirror(command cmd) {", "\tswitch (cmd.button) {"]
+    for a, b in sorted(MIRROR.items()):
+      out += ["\t\tcase {}:".format(a), "\t\t\tcmd.button = {};".format(b), "\t\t\tbreak;"]
+    out += ["\t\tdefault:", "\t\t\tbreak;", "\t}", "", "\treturn cmd;", "}", ""]
+  if any(isinstance(t, dict) for _, t in accessors):
+    out += ["/* 記述のないトラック・終わったトラック */",
+            "static inline command IdleTrack(uint8_t echo) {", "\tcommand cmd = { END, 0, echo };",
+            "\treturn cmd;", "}", ""]
+
+  for table in tables:
+    if table.base is not table:
+      continue
+    out.append("/* {}: {} entries, {} bytes */".format(table.name, table.count, table.count * table.width))
+    out.append("static const {} {}[] PROGMEM = {{".format(table.ctype(), table.name))
+    emit_items(table, table.items, out)
+    out.append("\t{}".format(entry(table, "END", table.end)))
+    out.append("};")
+    out.append("")
+
+  header = []
+  for phase, table in accessors:
+    if phase.mirror_of:
+      signature = "command {}(int index)".format(phase.name)
+      body = ["\treturn Mirror({});".format(own[phase.mirror_of].read(echo_c(phase.echo)))]
+    elif isinstance(table, dict):
+      signature = "command {}(int track, int index)".format(phase.name)
+      body = ["\tswitch (track) {"]
+      for track in TRACKS:
+        if track in table:
+          body += ["\t\tcase {}:".format(TRACK_ENUM[track]), "\t\t\treturn {};".format(table[track].read(echo_c(phase.echo)))]
+      body += ["\t}", "", "\treturn IdleTrack({});".format(echo_c(phase.echo))]
+    else:
+      signature = "command {}(int index)".format(phase.name)
+      body = ["\treturn {};".format(table.read(echo_c(phase.echo)))]
+      if table.base is not table:
+        out.append("/* {} は {} の末尾と共有 */".format(phase.name, table.base.name))
+    header.append(signature + ";")
+    out += [signature + " {", ""] + body + ["}", ""]
+
+  signature = "uint16_t Accepts(command (*phase)(int), Buttons_t button)"
+  out += ["/* route.txt の accepts: phase を終える待機の最後の何フレームで、次のステップの最初の入力 button を先に送れるか */",
+          signature + " {"]
+  for phase, accepts in accepting:
+    out += ["\tif (phase == {}) {{".format(phase.name)]
+    emit_window(accepts, out)
+    out += ["\t}", ""]
+  out += ["\treturn 0;", "}", ""]
+  header.append(signature + ";")
+
+  flash = sum(t.count * t.width for t in tables if t.base is t)
+  step_c = "\n".join(out)
+  route_h = "\n".join([
+    "/* {} から route2c.py で生成（直接編集しない） */".format(os.path.basename(source)), "",
+    "#ifndef _ROUTE_H_", "#define _ROUTE_H_", "",
+    "/* EEPROM のプログラム (Macro.h) でのテーブルの番号 */",
+    "typedef enum {"] + ["\t{},".format(t.id()) for t in tables] + ["\tTABLE_COUNT", "} Table_t;", "",
+    "/* テーブルの番号と Buttons_t の並びの CRC（プログラムはこれが同じファームウェアでだけ使われる） */",
+    "#define ROUTE_SIGNATURE 0x{:04X}".format(route_signature), "",
+    "/* Step.c 内の関数について定義 */"] + header + ["", "#endif", ""])
+  summary = "{} phases, {} table bytes in flash (hand-written arrays: {} bytes of flash and SRAM)".format(
+    len(accessors), flash, naive)
+  owners = {}
+  for phase, table in accessors:
+    if phase.mirror_of:
+      owners[phase.name] = [own[phase.mirror_of]]
+    elif isinstance(table, dict):
+      owners[phase.name] = [table[track] for track in TRACKS if track in table]
+    else:
+      owners[phase.name] = [table]
+  return step_c, route_h, summary, Program(tables, owners, route_signature, buttons)
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "ho:H:p:t:D:")
+  step_c_path, route_h_path = "Step.c", "Route.h"
+  program_path, phases, overrides = None, [], {}
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-o':
+      step_c_path = arg
+    elif opt == '-H':
+      route_h_path = arg
+    elif opt == '-p':
+      program_path = arg
+    elif opt == '-t':
+      phases += [name for name in arg.split(",") if name]
+    elif opt == '-D':
+      name, _, value = arg.partition("=")
+      overrides[name] = int(value or "1", 0)
+  if len(args) != 1:
+    usage()
+    sys.exit(2)
+
+  here = os.path.dirname(os.path.abspath(__file__))
+  try:
+    step_c, route_h, summary, program = compile_route(args[0], os.path.join(here, "Step.h"), os.path.join(here, "Config.h"))
+    if program_path:
+      values = read_values(os.path.join(here, "Config.h"))
+      values.update(read_values(os.path.join(here, "Macro.h")))
+      values.update(overrides)
+      data, count = program.build(phases, values)
+  except RouteError as e:
+    print("{}: {}".format(args[0], e))
+    sys.exit(1)
+
+  if program_path:
+    with open(program_path, 'wb') as f:
+      f.write(data)
+    print("{} compiled to {}: {} tables, {} of {} bytes (route 0x{:04X})".format(
+      args[0], program_path, count, len(data), values["MACRO_SIZE"], program.signature))
+    return
+
+  with open(step_c_path, 'w') as f:
+    f.write(step_c)
+  with open(route_h_path, 'w') as f:
+    f.write(route_h)
+  print("{} compiled to {} and {}: {}".format(args[0], step_c_path, route_h_path, summary))
+
+def usage():
+  print("To compile a route: route2c.py route.txt")
+  print("To choose the output files: route2c.py -o Step.c -H Route.h route.txt")
+  print("To compile it into a program for the EEPROM: route2c.py -p program.bin [-t Phase,...] [-D NAME=VALUE] route.txt")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit()
+  else:
+    main(sys.argv[1:])
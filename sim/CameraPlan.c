@@ -0,0 +1,107 @@
+/*
+Camera turns planned from a model of the camera's rotation rate, for sim -c.
+
+The rate tables below are guesses, not measurements: no route step turns
+the camera by an angle, and neither the model nor the planner is built into
+the firmware until the rates are measured on the console.
+*/
+
+#include "CameraPlan.h"
+
+// Rotation speed for each deflection of the right stick (0 - 127), as a fraction of the
+// full rate (65535): a dead zone around the center, then the 1.5 power of the deflection.
+static const uint16_t CameraResponse[CAMERA_MAX_DEFLECTION + 1] = {
+	    0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,    52,   146,   269,   414,   579,
+	  761,   959,  1172,  1398,  1638,  1889,  2153,  2427,
+	 2713,  3008,  3314,  3630,  3955,  4289,  4632,  4983,
+	 5344,  5712,  6089,  6473,  6865,  7265,  7672,  8087,
+	 8509,  8938,  9374,  9817, 10266, 10723, 11185, 11655,
+	12130, 12612, 13100, 13595, 14095, 14601, 15114, 15632,
+	16156, 16686, 17221, 17762, 18308, 18860, 19418, 19981,
+	20549, 21122, 21701, 22285, 22874, 23468, 24067, 24671,
+	25280, 25894, 26513, 27137, 27766, 28399, 29037, 29680,
+	30328, 30980, 31637, 32298, 32964, 33635, 34310, 34989,
+	35673, 36361, 37054, 37750, 38452, 39157, 39867, 40581,
+	41299, 42022, 42748, 43479, 44214, 44953, 45696, 46443,
+	47194, 47949, 48708, 49471, 50238, 51009, 51784, 52563,
+	53345, 54132, 54922, 55716, 56514, 57315, 58121, 58930,
+	59743, 60559, 61379, 62203, 63031, 63862, 64697, 65535,
+};
+
+// Rotation per frame at full deflection (thousandths of a degree), for sensitivity
+// -5.0 to +5.0 in steps of 0.5: 4 degrees at 0, times 1.1 per step.
+static const uint16_t CameraFullRate[CAMERA_SENSITIVITY_MAX - CAMERA_SENSITIVITY_MIN + 1] = {
+	 1542,  1696,  1866,  2053,  2258,  2484,  2732,  3005,  3306,  3636,
+	 4000,
+	 4400,  4840,  5324,  5856,  6442,  7086,  7795,  8574,  9432, 10375,
+};
+
+uint16_t CameraRate(uint8_t deflection, int sensitivity) {
+
+	if (deflection > CAMERA_MAX_DEFLECTION) {
+		deflection = CAMERA_MAX_DEFLECTION;
+	}
+	if (sensitivity < CAMERA_SENSITIVITY_MIN) {
+		sensitivity = CAMERA_SENSITIVITY_MIN;
+	}
+	if (sensitivity > CAMERA_SENSITIVITY_MAX) {
+		sensitivity = CAMERA_SENSITIVITY_MAX;
+	}
+
+	uint32_t full = CameraFullRate[sensitivity - CAMERA_SENSITIVITY_MIN];
+	uint32_t response = CameraResponse[deflection];
+	return (full * response + 32767) >> 16;
+}
+
+// The deflection whose rate over frames comes closest to angle (thousandths of a degree).
+static uint8_t CameraDeflection(uint32_t angle, uint16_t frames, int sensitivity) {
+	uint8_t low = 0, high = CAMERA_MAX_DEFLECTION;
+
+	// The smallest deflection that turns at least by angle, by bisection.
+	while (low < high) {
+		uint8_t middle = (low + high) / 2;
+		if ((uint32_t)CameraRate(middle, sensitivity) * frames >= angle) {
+			high = middle;
+		} else {
+			low = middle + 1;
+		}
+	}
+
+	// The deflection just below may come closer.
+	if (low > 0) {
+		uint32_t over = (uint32_t)CameraRate(low, sensitivity) * frames - angle;
+		uint32_t under = angle - (uint32_t)CameraRate(low - 1, sensitivity) * frames;
+		if (under < over) {
+			low--;
+		}
+	}
+
+	return low;
+}
+
+camera_move CameraPlan(int16_t yaw, int16_t pitch, int sensitivity) {
+	camera_move move = { 0, 0, 0, 0, 0 };
+	uint32_t yaw_abs = (uint32_t)(yaw < 0 ? -(int32_t)yaw : yaw) * 10;
+	uint32_t pitch_abs = (uint32_t)(pitch < 0 ? -(int32_t)pitch : pitch) * 10;
+	uint32_t longest = (yaw_abs > pitch_abs) ? yaw_abs : pitch_abs;
+	uint16_t full = CameraRate(CAMERA_MAX_DEFLECTION, sensitivity);
+
+	if (longest == 0 || full == 0) {
+		return move;
+	}
+
+	// The fewest frames are those of the longer axis at full deflection;
+	// each axis then gets the deflection that ends its turn in as many frames.
+	uint32_t frames = (longest + full - 1) / full;
+	move.frames = (frames > UINT16_MAX) ? UINT16_MAX : frames;
+
+	uint8_t dx = CameraDeflection(yaw_abs, move.frames, sensitivity);
+	uint8_t dy = CameraDeflection(pitch_abs, move.frames, sensitivity);
+	move.dx = (yaw < 0) ? -dx : dx;
+	move.dy = (pitch < 0) ? -dy : dy;
+	move.yaw = (int32_t)CameraRate(dx, sensitivity) * move.frames * (yaw < 0 ? -1 : 1);
+	move.pitch = (int32_t)CameraRate(dy, sensitivity) * move.frames * (pitch < 0 ? -1 : 1);
+
+	return move;
+}
@@ -0,0 +1,28 @@
+/* Plans camera turns with a model of the camera's rotation rate, for sim -c. */
+
+#ifndef _SIM_CAMERAPLAN_H_
+#define _SIM_CAMERAPLAN_H_
+
+#include <stdint.h>
+
+#define CAMERA_MAX_DEFLECTION 127 // deflection of the stick from its center to the edge
+#define CAMERA_SENSITIVITY_MIN -10 // in-game sensitivity times 2 (-5.0)
+#define CAMERA_SENSITIVITY_MAX  10 // in-game sensitivity times 2 (+5.0)
+
+// The right stick input of a turn.
+typedef struct {
+	int8_t   dx;     // deflection of the right stick X from its center (right is positive)
+	int8_t   dy;     // deflection of the right stick Y from its center (up is positive)
+	uint16_t frames; // frames it is held for (0: no turn)
+	int32_t  yaw;    // yaw it turns by, in thousandths of a degree
+	int32_t  pitch;  // pitch it turns by, in thousandths of a degree
+} camera_move;
+
+// Rotation per frame (thousandths of a degree) at this deflection and sensitivity.
+uint16_t CameraRate(uint8_t deflection, int sensitivity);
+
+// The input that turns by yaw and pitch (hundredths of a degree, right and
+// up positive) in the fewest frames, at the in-game sensitivity times 2.
+camera_move CameraPlan(int16_t yaw, int16_t pitch, int sensitivity);
+
+#endif
@@ -0,0 +1,548 @@
+/*
+Stand-in for the console: a model of the Splatoon 3 screens the route
+navigates, driven by the reports the firmware sends.
+
+The game reads the controller once per frame (60 Hz), not on every poll:
+a report is only seen when a frame starts while it is the latest one, so a
+press or a release shorter than a frame can be missed.
+
+The model knows the Change Grip/Order screen, the Splatsville map, the X
+menu of Alterna with its tabs, the options list with the motion-control
+switch and the sensitivity slider, the kettle selector of the super jump,
+the pause menu and the loading screens between them. Inputs are taken on
+the press (the frame where a button or HAT direction appears); a held HAT
+direction auto-repeats like a menu cursor does. Every transition keeps the
+console busy for a while, and presses that arrive in that time are dropped,
+so a route with inputs that are too close together lands on the wrong item.
+
+The drone launch and the stage itself are not modelled: inputs during
+CLEAR_STAGE and LUNCH_DRONE are ignored, apart from the final shot of the
+stage (ZR with the right stick aimed), which clears it and brings the
+player back to the kettle, and from ZL, which enters a kettle once the
+player stands at one. A drone run puts the player back in Alterna where
+the step ends. The timings below are estimates of the real game.
+
+When the controller is lost (ConsoleDisconnect()), the console shows the
+controller applet over whatever screen it was on, and takes no input until
+the controller is registered with L+R and A again; a console that slept
+also stops its clock for the time it was asleep.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Console.h"
+
+// Busy times of the console after a transition, in milliseconds.
+#define GRIP_REGISTER_MS   500
+#define GRIP_CLOSE_MS      300
+#define MENU_OPEN_MS       300
+#define MENU_CLOSE_MS      200
+#define TAB_SWITCH_MS      150
+#define LIST_OPEN_MS       200
+#define TOGGLE_MS          100
+#define SELECTOR_OPEN_MS   400
+#define CONFIRM_MS         300
+#define LOAD_ALTERNA_MS   8500
+#define LOAD_STAGE_MS     6000
+#define LOAD_SPLATSVILLE_MS 8000
+#define JUMP_MS           6200
+#define ZL_ENTER_MS        800 // how long ZL is held at a kettle to enter it
+#define CLEAR_RETURN_MS  21700 // from the final shot of a stage until the player is back at its kettle
+#define HAT_REPEAT_DELAY_MS 400
+#define HAT_REPEAT_MS      100
+#define GAME_FRAME_MS     (1000.0 / 60) // the game reads the controller once per frame
+
+typedef enum {
+	SCREEN_GRIP,      // Change Grip/Order
+	SCREEN_FIELD,     // walking around at place
+	SCREEN_LOADING,   // loading into place
+	SCREEN_MAP,       // Splatsville map
+	SCREEN_MENU,      // X menu of Alterna, cursor on the tab bar
+	SCREEN_OPTIONS,   // options list of the Options tab
+	SCREEN_KETTLES,   // kettle selector of the Map tab
+	SCREEN_CONFIRM,   // "Super jump to this kettle?"
+	SCREEN_JUMPING,   // super jump in flight
+	SCREEN_PAUSE,     // "Return to Splatsville?"
+	SCREEN_STAGE,     // inside a kettle
+} Screen_t;
+
+typedef enum {
+	PLACE_SPLATSVILLE,
+	PLACE_ALTERNA,
+	PLACE_KETTLE,
+	PLACE_STAGE,
+} Place_t;
+
+typedef enum {
+	IN_A, IN_B, IN_X, IN_L, IN_R, IN_LR, IN_PLUS, IN_MINUS, IN_ZL,
+	IN_UP, IN_DOWN, IN_LEFT, IN_RIGHT,
+} Input_t;
+
+static const char* const ScreenNames[] = {
+	"grip", "field", "loading", "map", "menu", "options", "kettles", "confirm", "jumping", "pause", "stage",
+};
+static const char* const PlaceNames[] = { "Splatsville", "Alterna", "kettle", "stage" };
+static const char* const MapItems[] = { "Splatsville", "Alterna", "Grand Festival" };
+static const char* const Tabs[] = { "Map", "Gear", "Options" };
+static const char* const OptionRows[] = { "Motion controls", "Sensitivity", "Invert" };
+static const char* const Kettles[] = { "Crater", "1-6", "1-7", "1-8", "1-9" };
+
+#define COUNT(a) ((int)(sizeof(a) / sizeof((a)[0])))
+#define TAB_MAP         0
+#define TAB_OPTIONS     2
+#define ROW_MOTION      0
+#define ROW_SENSITIVITY 1
+#define KETTLE_1_8      3
+
+extern int sensitivity_set; // Joystick.c: the sensitivity the route plays at (x2)
+
+static struct {
+	Screen_t screen;
+	Place_t  place;
+	int      cursor;       // item, tab or row of the screen
+	int      kettle;       // kettle the player is at or jumping to
+	bool     registered;
+	bool     applet;       // the controller applet is shown over the screen
+	double   applet_until; // the applet is busy until then, apart from the game
+	int      gyro;
+	int      sensitivity;  // x2, as sensitivity_val
+	double   busy_until;
+	double   now;
+	double   next_frame;   // when the game next reads the controller
+	USB_JoystickReport_Input_t held; // the last report polled, in front of the game until the next one
+	Step_t   held_step;    // the step that made it
+	uint16_t buttons;      // buttons the game read on its previous frame
+	uint8_t  hat;
+	double   hat_repeat_at;
+	double   zl_since;
+	long     dropped;
+	char     where[64];
+} console;
+
+static Place_t start_place;
+
+// Nothing is held on the controller.
+static void Release(void) {
+	memset(&console.held, 0, sizeof(console.held));
+	console.held.LX = console.held.LY = console.held.RX = console.held.RY = STICK_CENTER;
+	console.held.HAT = HAT_CENTER;
+}
+
+void ConsoleInit(bool at_kettle) {
+	memset(&console, 0, sizeof(console));
+	console.screen = SCREEN_GRIP;
+	console.hat = HAT_CENTER;
+	Release();
+	console.gyro = GYRO_SETTING;
+	console.sensitivity = SENSITIVITY * 2;
+	start_place = at_kettle ? PLACE_KETTLE : PLACE_SPLATSVILLE;
+	if (at_kettle) {
+		// START_AT_KETTLE: the options are already the route's, as Config.h asks.
+		console.gyro = 0;
+		console.sensitivity = sensitivity_set;
+	}
+	console.kettle = KETTLE_1_8;
+}
+
+static void Busy(double ms) {
+	console.busy_until = console.now + ms;
+}
+
+static void Move(int* cursor, int step, int count) {
+	*cursor += step;
+	if (*cursor < 0) {
+		*cursor = 0;
+	}
+	if (*cursor >= count) {
+		*cursor = count - 1;
+	}
+}
+
+// Finish loading screens and super jumps whose time has come.
+static void Settle(void) {
+	if ((console.screen == SCREEN_LOADING || console.screen == SCREEN_JUMPING) && console.now >= console.busy_until) {
+		console.screen = (console.place == PLACE_STAGE) ? SCREEN_STAGE : SCREEN_FIELD;
+	}
+}
+
+static void Press(Input_t input) {
+	// The applet takes input even while the game under it is loading.
+	if (console.applet) {
+		if (console.now < console.applet_until) {
+			console.dropped++;
+		} else if (input == IN_LR) {
+			console.registered = true;
+			console.applet_until = console.now + GRIP_REGISTER_MS;
+		} else if (input == IN_A && console.registered) {
+			// Registered again, the applet closes on the screen it was shown over.
+			console.applet = false;
+			if (console.busy_until < console.now + GRIP_CLOSE_MS) {
+				Busy(GRIP_CLOSE_MS);
+			}
+		}
+		return;
+	}
+
+	if (console.now < console.busy_until) {
+		console.dropped++;
+		return;
+	}
+
+	switch (console.screen) {
+		case SCREEN_GRIP:
+			if (input == IN_LR) {
+				console.registered = true;
+				Busy(GRIP_REGISTER_MS);
+			} else if (input == IN_A && console.registered) {
+				console.screen = SCREEN_FIELD;
+				console.place = start_place;
+				Busy(GRIP_CLOSE_MS);
+			}
+			break;
+
+		case SCREEN_FIELD:
+			if (input == IN_X) {
+				console.screen = (console.place == PLACE_SPLATSVILLE) ? SCREEN_MAP : SCREEN_MENU;
+				console.cursor = (console.place == PLACE_SPLATSVILLE) ? 0 : TAB_MAP;
+				Busy(MENU_OPEN_MS);
+			} else if (input == IN_PLUS && console.place != PLACE_SPLATSVILLE) {
+				console.screen = SCREEN_PAUSE;
+				Busy(MENU_OPEN_MS);
+			}
+			break;
+
+		case SCREEN_STAGE:
+			if (input == IN_PLUS) {
+				console.screen = SCREEN_PAUSE;
+				Busy(MENU_OPEN_MS);
+			}
+			break;
+
+		case SCREEN_MAP:
+			if (input == IN_UP || input == IN_DOWN) {
+				Move(&console.cursor, input == IN_DOWN ? 1 : -1, COUNT(MapItems));
+			} else if (input == IN_A) {
+				console.screen = SCREEN_LOADING;
+				console.place = (console.cursor == 1) ? PLACE_ALTERNA : PLACE_SPLATSVILLE;
+				Busy(LOAD_ALTERNA_MS);
+			} else if (input == IN_B) {
+				console.screen = SCREEN_FIELD;
+				Busy(MENU_CLOSE_MS);
+			}
+			break;
+
+		case SCREEN_MENU:
+		case SCREEN_OPTIONS:
+			if (input == IN_L || input == IN_R) {
+				// The tab bar wraps around, and switching tabs puts the cursor back on it.
+				int tab = (console.screen == SCREEN_MENU) ? console.cursor : TAB_OPTIONS;
+				console.cursor = (tab + (input == IN_R ? 1 : COUNT(Tabs) - 1)) % COUNT(Tabs);
+				console.screen = SCREEN_MENU;
+				Busy(TAB_SWITCH_MS);
+			} else if (input == IN_B) {
+				console.screen = SCREEN_FIELD;
+				Busy(MENU_CLOSE_MS);
+			} else if (console.screen == SCREEN_MENU && input == IN_A) {
+				if (console.cursor == TAB_OPTIONS) {
+					console.screen = SCREEN_OPTIONS;
+					console.cursor = ROW_SENSITIVITY;
+					Busy(LIST_OPEN_MS);
+				} else if (console.cursor == TAB_MAP) {
+					// The selector always opens on its first kettle.
+					console.screen = SCREEN_KETTLES;
+					console.cursor = 0;
+					Busy(SELECTOR_OPEN_MS);
+				}
+			} else if (console.screen == SCREEN_OPTIONS) {
+				if (input == IN_UP || input == IN_DOWN) {
+					Move(&console.cursor, input == IN_DOWN ? 1 : -1, COUNT(OptionRows));
+				} else if (input == IN_A && console.cursor == ROW_MOTION) {
+					console.gyro = !console.gyro;
+					Busy(TOGGLE_MS);
+				} else if ((input == IN_LEFT || input == IN_RIGHT) && console.cursor == ROW_SENSITIVITY) {
+					// The slider moves 0.5 per press, from -5.0 to +5.0.
+					console.sensitivity += (input == IN_RIGHT) ? 1 : -1;
+					if (console.sensitivity < -10) {
+						console.sensitivity = -10;
+					}
+					if (console.sensitivity > 10) {
+						console.sensitivity = 10;
+					}
+				}
+			}
+			break;
+
+		case SCREEN_KETTLES:
+			if (input == IN_UP || input == IN_DOWN) {
+				Move(&console.cursor, input == IN_UP ? 1 : -1, COUNT(Kettles));
+			} else if (input == IN_A) {
+				console.screen = SCREEN_CONFIRM;
+				console.kettle = console.cursor;
+				Busy(CONFIRM_MS);
+			} else if (input == IN_B) {
+				console.screen = SCREEN_MENU;
+				console.cursor = TAB_MAP;
+				Busy(TAB_SWITCH_MS);
+			}
+			break;
+
+		case SCREEN_CONFIRM:
+			if (input == IN_A) {
+				console.screen = SCREEN_JUMPING;
+				console.place = PLACE_KETTLE;
+				Busy(JUMP_MS);
+			} else if (input == IN_B) {
+				console.screen = SCREEN_KETTLES;
+				Busy(CONFIRM_MS);
+			}
+			break;
+
+		case SCREEN_PAUSE:
+			// In a stage the pause menu quits back to its kettle.
+			if (input == IN_A && console.place == PLACE_STAGE) {
+				console.screen = SCREEN_LOADING;
+				console.place = PLACE_KETTLE;
+				Busy(LOAD_STAGE_MS);
+			} else if (input == IN_A) {
+				console.screen = SCREEN_LOADING;
+				console.place = PLACE_SPLATSVILLE;
+				Busy(LOAD_SPLATSVILLE_MS);
+			} else if (input == IN_B) {
+				console.screen = (console.place == PLACE_STAGE) ? SCREEN_STAGE : SCREEN_FIELD;
+				Busy(MENU_CLOSE_MS);
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+static Input_t HatInput(uint8_t hat) {
+	switch (hat) {
+		case HAT_TOP:    return IN_UP;
+		case HAT_BOTTOM: return IN_DOWN;
+		case HAT_LEFT:   return IN_LEFT;
+		default:         return IN_RIGHT;
+	}
+}
+
+// The game reads the report in front of it at the start of a frame.
+static void ReadFrame(void) {
+	const USB_JoystickReport_Input_t* report = &console.held;
+	uint16_t pressed = report->Button & ~console.buttons;
+	bool modelled = (console.held_step != CLEAR_STAGE && console.held_step != LUNCH_DRONE);
+
+	console.now = console.next_frame;
+	console.next_frame += GAME_FRAME_MS;
+	Settle();
+
+	if (modelled) {
+		if ((pressed & (SWITCH_L | SWITCH_R)) && (report->Button & (SWITCH_L | SWITCH_R)) == (SWITCH_L | SWITCH_R)) {
+			Press(IN_LR);
+		} else {
+			if (pressed & SWITCH_L) Press(IN_L);
+			if (pressed & SWITCH_R) Press(IN_R);
+		}
+		if (pressed & SWITCH_A) Press(IN_A);
+		if (pressed & SWITCH_B) Press(IN_B);
+		if (pressed & SWITCH_X) Press(IN_X);
+		if (pressed & SWITCH_PLUS) Press(IN_PLUS);
+		if (pressed & SWITCH_MINUS) Press(IN_MINUS);
+
+		// Only the four main HAT directions move a menu cursor.
+		bool direction = (report->HAT == HAT_TOP || report->HAT == HAT_BOTTOM || report->HAT == HAT_LEFT || report->HAT == HAT_RIGHT);
+		if (direction && report->HAT != console.hat) {
+			Press(HatInput(report->HAT));
+			console.hat_repeat_at = console.now + HAT_REPEAT_DELAY_MS;
+		} else if (direction && console.now >= console.hat_repeat_at) {
+			Press(HatInput(report->HAT));
+			console.hat_repeat_at += HAT_REPEAT_MS;
+		}
+
+	} else if (console.held_step == CLEAR_STAGE && console.screen == SCREEN_STAGE
+		&& (report->Button & SWITCH_ZR) && report->RX != STICK_CENTER) {
+		// The final shot clears the stage; the result screens lead back to the kettle.
+		console.screen = SCREEN_LOADING;
+		console.place = PLACE_KETTLE;
+		Busy(CLEAR_RETURN_MS);
+	}
+
+	// Holding ZL at a kettle enters it. A hold that started earlier (on a
+	// loading screen or in the air) only counts from when the player stands there.
+	if (report->Button & SWITCH_ZL) {
+		bool ready = !console.applet && console.screen == SCREEN_FIELD && console.place == PLACE_KETTLE;
+		if (!(console.buttons & SWITCH_ZL) || !ready) {
+			console.zl_since = console.now;
+		} else if (console.now - console.zl_since >= ZL_ENTER_MS) {
+			console.screen = SCREEN_LOADING;
+			console.place = PLACE_STAGE;
+			Busy(LOAD_STAGE_MS);
+		}
+	}
+
+	console.buttons = report->Button;
+	console.hat = report->HAT;
+}
+
+void ConsoleFeed(const USB_JoystickReport_Input_t* report, Step_t step, double now_ms) {
+	// The previous report stayed in front of the game until this poll
+	// replaced it; a report no frame started on is never read.
+	while (console.next_frame < now_ms) {
+		ReadFrame();
+	}
+
+	console.held = *report;
+	console.held_step = step;
+	console.now = now_ms;
+	Settle();
+}
+
+void ConsoleDisconnect(double asleep_ms) {
+	// The game reads the last report before it drops the controller.
+	ReadFrame();
+	console.registered = false;
+	// Nothing is held any more.
+	Release();
+	console.buttons = 0;
+	console.hat = HAT_CENTER;
+	// Before the game is in front, the Change Grip/Order screen is the applet.
+	if (console.screen != SCREEN_GRIP) {
+		console.applet = true;
+		// A game that slept resumes where it stopped.
+		console.busy_until += asleep_ms;
+	}
+}
+
+const char* ConsoleWhere(void) {
+	const char* item = NULL;
+
+	if (console.applet) {
+		snprintf(console.where, sizeof(console.where), "%s/%s over %s", ScreenNames[SCREEN_GRIP],
+			console.registered ? "registered" : "waiting", ScreenNames[console.screen]);
+		return console.where;
+	}
+
+	switch (console.screen) {
+		case SCREEN_FIELD:
+		case SCREEN_LOADING:
+		case SCREEN_JUMPING:
+			item = (console.place == PLACE_KETTLE) ? Kettles[console.kettle] : PlaceNames[console.place];
+			break;
+		case SCREEN_MAP:     item = MapItems[console.cursor]; break;
+		case SCREEN_MENU:    item = Tabs[console.cursor]; break;
+		case SCREEN_OPTIONS: item = OptionRows[console.cursor]; break;
+		case SCREEN_KETTLES: item = Kettles[console.cursor]; break;
+		case SCREEN_CONFIRM: item = Kettles[console.kettle]; break;
+		case SCREEN_STAGE:   item = Kettles[console.kettle]; break;
+		default:             item = console.registered ? "registered" : "waiting"; break;
+	}
+
+	snprintf(console.where, sizeof(console.where), "%s/%s gyro %d sensitivity %d",
+		ScreenNames[console.screen], item, console.gyro, console.sensitivity);
+	return console.where;
+}
+
+long ConsoleDropped(void) {
+	return console.dropped;
+}
+
+size_t ConsoleSave(void* state, size_t size) {
+	if (size < sizeof(console) + sizeof(start_place)) {
+		return 0;
+	}
+	memcpy(state, &console, sizeof(console));
+	memcpy((uint8_t*)state + sizeof(console), &start_place, sizeof(start_place));
+	return sizeof(console) + sizeof(start_place);
+}
+
+void ConsoleLoad(const void* state) {
+	memcpy(&console, state, sizeof(console));
+	memcpy(&start_place, (const uint8_t*)state + sizeof(console), sizeof(start_place));
+}
+
+bool ConsoleEndOfStep(Step_t step, char* why, size_t size) {
+	const char* expected = NULL;
+
+	Settle();
+	switch (step) {
+		case SYNC_CONTROLLER:
+			if (console.screen != SCREEN_FIELD) {
+				expected = "the controller registered and the game in front";
+			}
+			break;
+
+		case GO_TO_ALTERNA:
+			// A route that starts at the kettle seeks past the trip to Alterna.
+			if (console.screen != SCREEN_FIELD || console.place != (start_place == PLACE_KETTLE ? PLACE_KETTLE : PLACE_ALTERNA)) {
+				expected = "Alterna loaded";
+			}
+			break;
+
+		case OPEN_OPTION:
+		case TURN_OFF_GYRO:
+		case SET_SENSITIVITY:
+		case RESET_SENSITIVITY:
+			if (console.screen != SCREEN_OPTIONS || console.cursor != ROW_SENSITIVITY) {
+				expected = "the options list on Sensitivity";
+			} else if (step == TURN_OFF_GYRO && console.gyro) {
+				expected = "motion controls off";
+			} else if (step == SET_SENSITIVITY && console.sensitivity != sensitivity_set) {
+				expected = "the route's sensitivity";
+			} else if (step == RESET_SENSITIVITY && console.sensitivity != SENSITIVITY * 2) {
+				expected = "the user's sensitivity restored";
+			}
+			break;
+
+		case JUMP_TO_STAGE:
+		case CLEAR_STAGE:
+			// A ZL hold played early (route.txt: accepts) may already have entered the
+			// stage, and after an interruption the stage may even have finished loading.
+			if (console.kettle != KETTLE_1_8 || !((console.screen == SCREEN_FIELD && console.place == PLACE_KETTLE)
+				|| (console.place == PLACE_STAGE && (console.screen == SCREEN_LOADING || console.screen == SCREEN_STAGE)))) {
+				expected = (step == JUMP_TO_STAGE) ? "landed at the 1-8 kettle" : "back at the 1-8 kettle";
+			}
+			break;
+
+		case ENTER_STAGE:
+			if (console.screen != SCREEN_STAGE) {
+				expected = "inside the 1-8 kettle";
+			}
+			break;
+
+		case LUNCH_DRONE:
+			// Not modelled: the drone run ends in the field of Alterna.
+			console.screen = SCREEN_FIELD;
+			console.place = PLACE_ALTERNA;
+			break;
+
+		case RESET_GYRO_SETTING:
+			if (console.screen != SCREEN_OPTIONS || console.gyro != GYRO_SETTING) {
+				expected = "the user's motion controls restored";
+			}
+			break;
+
+		case RECONNECT:
+			if (console.applet || (console.screen != SCREEN_FIELD && console.screen != SCREEN_LOADING
+				&& console.screen != SCREEN_JUMPING && console.screen != SCREEN_STAGE)) {
+				expected = "the controller registered and every menu closed";
+			}
+			break;
+
+		case BACK_TO_SPLATSVILLE:
+			if ((console.screen != SCREEN_LOADING && console.screen != SCREEN_FIELD) || console.place != PLACE_SPLATSVILLE) {
+				expected = "on the way back to Splatsville";
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	if (expected) {
+		snprintf(why, size, "expected %s, console at %s", expected, ConsoleWhere());
+		return false;
+	}
+	return true;
+}
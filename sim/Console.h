@@ -0,0 +1,41 @@
+/* Stand-in for the console: a model of the menus the route navigates. */
+
+#ifndef _SIM_CONSOLE_H_
+#define _SIM_CONSOLE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Joystick.h"
+
+// Reset the model to the Change Grip/Order screen. The player is in
+// Splatsville, or already at the 1-8 kettle when the route starts there.
+void ConsoleInit(bool at_kettle);
+
+// Feed one report polled from GetNextReport() at time now_ms, while the
+// route is in the given step.
+void ConsoleFeed(const USB_JoystickReport_Input_t* report, Step_t step, double now_ms);
+
+// The console lost the controller: it was unplugged, or (asleep_ms > 0)
+// the console slept for that long with the game stopped. The controller
+// applet is shown until the controller is registered again.
+void ConsoleDisconnect(double asleep_ms);
+
+// Where the cursor is, e.g. "options/Sensitivity -10" or "field/1-8".
+const char* ConsoleWhere(void);
+
+// Inputs that arrived while the console was busy and were ignored.
+long ConsoleDropped(void);
+
+// The model's state as plain bytes, for a snapshot of the run (sim -S).
+// ConsoleSave() copies it out and returns its size, or 0 when it does not
+// fit in size; ConsoleLoad() puts back what ConsoleSave() copied.
+#define CONSOLE_SNAPSHOT_SIZE 512
+size_t ConsoleSave(void* state, size_t size);
+void ConsoleLoad(const void* state);
+
+// Check where a step has left the console. Returns false and describes the
+// problem in why when the step landed on the wrong screen or item.
+bool ConsoleEndOfStep(Step_t step, char* why, size_t size);
+
+#endif
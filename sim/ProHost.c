@@ -0,0 +1,257 @@
+/*
+Stand-in for the Switch's side of the Pro Controller protocol.
+
+ProHostConnect() plays the host's part of the USB handshake (0x80 commands)
+and the subcommands (0x01) the console sends before it asks for full
+reports, checking every 0x81/0x21 reply. The stick and IMU calibration are
+read back from the firmware's SPI flash like the console does, and
+ProHostCheck() decodes each 0x30 report with them: buttons, d-pad and
+sticks must match the HORI report the route produced, and the IMU must
+report a controller lying still.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ProHost.h"
+
+static uint8_t counter = 0;
+static uint8_t reply[PRO_REPORT_SIZE];
+
+// Calibration read from SPI flash.
+static int stick_center[4], stick_above[4], stick_below[4]; // lx, ly, rx, ry
+static int gyro_origin, gyro_sens;
+static bool calibrated = false;
+
+static uint16_t Unpack(const uint8_t* data, int axis) {
+	return axis ? (data[1] >> 4) | (data[2] << 4) : data[0] | ((data[1] & 0x0F) << 8);
+}
+
+static int16_t Word(const uint8_t* data) {
+	return (int16_t)(data[0] | (data[1] << 8));
+}
+
+static bool UsbCommand(uint8_t command, bool answered, char* why, size_t size) {
+	uint8_t out[2] = { PRO_OUT_USB, command };
+
+	ProControllerOut(out, sizeof(out));
+	uint8_t length = ProControllerReply(reply);
+	if (!answered) {
+		if (length) {
+			snprintf(why, size, "0x80 0x%02x was answered", command);
+			return false;
+		}
+		return true;
+	}
+	if (length != PRO_REPORT_SIZE || reply[0] != PRO_REPORT_USB || reply[1] != command) {
+		snprintf(why, size, "0x80 0x%02x got %d bytes starting 0x%02x 0x%02x", command, length, reply[0], reply[1]);
+		return false;
+	}
+	return true;
+}
+
+static bool Subcommand(uint8_t id, const uint8_t* args, uint8_t count, uint8_t ack, char* why, size_t size) {
+	uint8_t out[PRO_REPORT_SIZE] = { PRO_OUT_SUBCOMMAND, counter++ & 0x0F };
+
+	out[10] = id;
+	memcpy(&out[11], args, count);
+	ProControllerOut(out, 11 + count);
+	uint8_t length = ProControllerReply(reply);
+	if (length != PRO_REPORT_SIZE || reply[0] != PRO_REPORT_REPLY || reply[14] != id || reply[13] != ack) {
+		snprintf(why, size, "subcommand 0x%02x got %d bytes, report 0x%02x, ack 0x%02x for 0x%02x",
+			id, length, reply[0], reply[13], reply[14]);
+		return false;
+	}
+	// Every reply also carries the inputs; none are held before the route starts.
+	if (reply[3] || reply[4] || reply[5]) {
+		snprintf(why, size, "subcommand 0x%02x reply holds buttons %02x %02x %02x", id, reply[3], reply[4], reply[5]);
+		return false;
+	}
+	return true;
+}
+
+static bool ReadSpi(uint16_t address, uint8_t length, uint8_t* data, char* why, size_t size) {
+	uint8_t args[5] = { address & 0xFF, address >> 8, 0, 0, length };
+
+	if (!Subcommand(PRO_SUB_SPI_READ, args, sizeof(args), 0x90, why, size)) {
+		return false;
+	}
+	if (memcmp(&reply[15], args, sizeof(args)) != 0) {
+		snprintf(why, size, "SPI read of 0x%04x echoed 0x%02x%02x length %d", address, reply[16], reply[15], reply[19]);
+		return false;
+	}
+	memcpy(data, &reply[20], length);
+	return true;
+}
+
+bool ProHostConnect(char* why, size_t size) {
+	static const uint8_t Setup[][3] = {
+		// id, argument, ack
+		{ PRO_SUB_SHIPMENT,   0x00, 0x80 },
+		{ PRO_SUB_INPUT_MODE, 0x30, 0x80 },
+		{ PRO_SUB_TRIGGERS,   0x00, 0x83 },
+		{ PRO_SUB_IMU,        0x01, 0x80 },
+		{ PRO_SUB_VIBRATION,  0x01, 0x80 },
+		{ PRO_SUB_PLAYER,     0x01, 0x80 },
+		{ PRO_SUB_HOME_LIGHT, 0x00, 0x80 },
+	};
+	uint8_t data[32];
+
+	if (ProControllerStreaming()) {
+		snprintf(why, size, "full reports before the handshake");
+		return false;
+	}
+	if (!UsbCommand(PRO_USB_STATUS, true, why, size)) {
+		return false;
+	}
+	if (reply[3] != 0x03) {
+		snprintf(why, size, "status reports controller type 0x%02x", reply[3]);
+		return false;
+	}
+	if (!UsbCommand(PRO_USB_HANDSHAKE, true, why, size)
+		|| !UsbCommand(PRO_USB_BAUDRATE, true, why, size)
+		|| !UsbCommand(PRO_USB_HANDSHAKE, true, why, size)
+		|| !UsbCommand(PRO_USB_HID_ONLY, false, why, size)) {
+		return false;
+	}
+	if (!ProControllerStreaming()) {
+		snprintf(why, size, "no full reports after 0x80 0x04");
+		return false;
+	}
+
+	if (!Subcommand(PRO_SUB_DEVICE_INFO, NULL, 0, 0x82, why, size)) {
+		return false;
+	}
+	if (reply[17] != 0x03) {
+		snprintf(why, size, "device info reports controller type 0x%02x", reply[17]);
+		return false;
+	}
+
+	// The reads the console makes, in its order.
+	if (!ReadSpi(0x6000, 16, data, why, size) || !ReadSpi(0x6050, 13, data, why, size)
+		|| !ReadSpi(0x6080, 24, data, why, size) || !ReadSpi(0x6098, 18, data, why, size)) {
+		return false;
+	}
+	if (!ReadSpi(0x8010, 22, data, why, size)) {
+		return false;
+	}
+	bool user_sticks = (data[0] == 0xB2 && data[1] == 0xA1);
+	if (!ReadSpi(0x603D, 18, data, why, size)) {
+		return false;
+	}
+	if (user_sticks) {
+		snprintf(why, size, "user stick calibration is set");
+		return false;
+	}
+	for (int axis = 0; axis < 2; axis++) {
+		stick_above[axis]     = Unpack(&data[0], axis);
+		stick_center[axis]    = Unpack(&data[3], axis);
+		stick_below[axis]     = Unpack(&data[6], axis);
+		stick_center[2 + axis] = Unpack(&data[9], axis);
+		stick_below[2 + axis]  = Unpack(&data[12], axis);
+		stick_above[2 + axis]  = Unpack(&data[15], axis);
+	}
+	if (!ReadSpi(0x6020, 24, data, why, size)) {
+		return false;
+	}
+	gyro_origin = Word(&data[14]);
+	gyro_sens = Word(&data[20]);
+	if (gyro_sens == gyro_origin) {
+		snprintf(why, size, "gyro calibration has no range");
+		return false;
+	}
+
+	if (!Subcommand(PRO_SUB_MCU_CONFIG, (const uint8_t[]){ 0x21, 0x00, 0x00 }, 3, 0xA0, why, size)) {
+		return false;
+	}
+	for (size_t i = 0; i < sizeof(Setup) / sizeof(Setup[0]); i++) {
+		if (!Subcommand(Setup[i][0], &Setup[i][1], 1, Setup[i][2], why, size)) {
+			return false;
+		}
+	}
+
+	calibrated = true;
+	return true;
+}
+
+// A decoded stick axis on the HORI pad's scale (0 - 255, down/right large).
+static int Stick(const uint8_t* data, int index, bool up) {
+	int offset = Unpack(data, index & 1) - stick_center[index];
+	int range = (offset >= 0) ? stick_above[index] : stick_below[index];
+	int value = (int)lround(offset * 127.0 / range);
+
+	return STICK_CENTER + (up ? -value : value);
+}
+
+bool ProHostCheck(const USB_JoystickReport_Input_t* report, char* why, size_t size) {
+	static const struct { uint16_t hori; int byte; uint8_t pro; } Buttons[] = {
+		{ SWITCH_Y, 3, PRO_Y }, { SWITCH_X, 3, PRO_X }, { SWITCH_B, 3, PRO_B }, { SWITCH_A, 3, PRO_A },
+		{ SWITCH_R, 3, PRO_R }, { SWITCH_ZR, 3, PRO_ZR },
+		{ SWITCH_MINUS, 4, PRO_MINUS }, { SWITCH_PLUS, 4, PRO_PLUS },
+		{ SWITCH_RCLICK, 4, PRO_RCLICK }, { SWITCH_LCLICK, 4, PRO_LCLICK },
+		{ SWITCH_HOME, 4, PRO_HOME }, { SWITCH_CAPTURE, 4, PRO_CAPTURE },
+		{ SWITCH_L, 5, PRO_L }, { SWITCH_ZL, 5, PRO_ZL },
+	};
+	// d-pad bits (up, down, left, right) of each HAT value
+	static const char* Hats[] = { "u", "ur", "r", "dr", "d", "dl", "l", "ul", "" };
+	uint8_t packet[PRO_REPORT_SIZE];
+	pro_input input;
+
+	if (!calibrated) {
+		snprintf(why, size, "polled before the handshake");
+		return false;
+	}
+
+	ProInput(report, &input);
+	ProControllerFull(&input, packet);
+	if (packet[0] != PRO_REPORT_FULL) {
+		snprintf(why, size, "report 0x%02x instead of 0x30", packet[0]);
+		return false;
+	}
+
+	uint16_t buttons = 0;
+	for (size_t i = 0; i < sizeof(Buttons) / sizeof(Buttons[0]); i++) {
+		if (packet[Buttons[i].byte] & Buttons[i].pro) {
+			buttons |= Buttons[i].hori;
+		}
+	}
+	if (buttons != report->Button) {
+		snprintf(why, size, "buttons 0x%04x decoded as 0x%04x", report->Button, buttons);
+		return false;
+	}
+
+	char hat[3] = "";
+	uint8_t dpad = packet[5];
+	snprintf(hat, sizeof(hat), "%s%s", (dpad & PRO_UP) ? "u" : (dpad & PRO_DOWN) ? "d" : "",
+		(dpad & PRO_RIGHT) ? "r" : (dpad & PRO_LEFT) ? "l" : "");
+	const char* expected = Hats[report->HAT < 8 ? report->HAT : 8];
+	if (strcmp(hat, expected) != 0) {
+		snprintf(why, size, "HAT %d decoded as d-pad \"%s\"", report->HAT, hat);
+		return false;
+	}
+
+	int lx = Stick(&packet[6], 0, false), ly = Stick(&packet[6], 1, true);
+	int rx = Stick(&packet[9], 2, false), ry = Stick(&packet[9], 3, true);
+	if (lx != report->LX || ly != report->LY || rx != report->RX || ry != report->RY) {
+		snprintf(why, size, "sticks %d,%d %d,%d decoded as %d,%d %d,%d",
+			report->LX, report->LY, report->RX, report->RY, lx, ly, rx, ry);
+		return false;
+	}
+
+	// Every IMU sample must hold the same rate; the console integrates them.
+	for (int i = 1; i < 3; i++) {
+		if (memcmp(&packet[13], &packet[13 + 12 * i], 12) != 0) {
+			snprintf(why, size, "IMU sample %d differs from the first", i);
+			return false;
+		}
+	}
+	double pitch = (Word(&packet[13 + 8]) - gyro_origin) * 936.0 / (gyro_sens - gyro_origin);
+	double yaw = (Word(&packet[13 + 10]) - gyro_origin) * 936.0 / (gyro_sens - gyro_origin);
+	if (fabs(pitch) > 0.5 || fabs(yaw) > 0.5) {
+		snprintf(why, size, "IMU turns at %.1f,%.1f dps where the controller lies still", pitch, yaw);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,21 @@
+/* Stand-in for the Switch's side of the Pro Controller protocol (PRO_CONTROLLER). */
+
+#ifndef _SIM_PROHOST_H_
+#define _SIM_PROHOST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Joystick.h"
+
+// Run the USB handshake and the subcommands the Switch sends before it asks
+// for full reports, reading the calibration the firmware reports on the way.
+// Returns false and describes the first wrong or missing reply in why.
+bool ProHostConnect(char* why, size_t size);
+
+// Encode a report polled from GetNextReport() the way HID_Task() sends it,
+// decode it with the calibration read by ProHostConnect(), and check that it
+// carries the same inputs.
+bool ProHostCheck(const USB_JoystickReport_Input_t* report, char* why, size_t size);
+
+#endif
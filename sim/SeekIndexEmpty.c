@@ -0,0 +1,10 @@
+/* Empty route index, linked while the real SeekIndex.c is being generated. */
+
+#include "../SeekIndex.h"
+
+const seek_entry SeekIndex[] PROGMEM = { { 0 } };
+const uint16_t SeekIndexSize = 0;
+const uint16_t SeekPhaseStart[] PROGMEM = { SEEK_NONE };
+const uint8_t SeekPhaseCount = 0;
+const uint32_t SeekEndFrame = 0;
+const uint32_t SeekLoopFrame = SEEK_NO_LOOP;
@@ -0,0 +1,1380 @@
+/*
+Host simulator for the macro engine.
+
+Joystick.c is compiled unchanged against the stand-in headers in include/,
+and GetNextReport() is polled the way the Switch polls the IN endpoint.
+The run is summarised as one JSON object on stdout: total polls, cycle
+length, polls spent in each step, the deepest stack of the engine and any
+invariant violations.
+
+GetNextReport() runs on a stack of its own, painted by MemoryPaint(), and
+the stack depth is read back through the firmware's MEMORY_REQUEST vendor
+request, as a PC reads it from the controller. It is measured with the
+host's ABI, so it tracks changes rather than the AVR's numbers.
+
+With -i the route is instead flattened into the frame-offset index that
+the firmware seeks with, and written to stdout as SeekIndex.c.
+
+With -r a black box read from a controller (gadget/reader -b) is replayed:
+the engine is restored to the oldest recorded step and run forward, every
+later step change must happen at the poll the controller recorded, and -t
+prints the report stream the controller sent in between. -b writes the
+simulator's own black box, and -z makes the host stop polling for a while:
+just a gap, or the console sleeping (USB suspend) or the cable unplugged,
+both followed by a new enumeration. The console model then shows its
+controller applet, and the route must register again and resume. A reset
+is the watchdog firing: SRAM starts over apart from .noinit, SetupHardware()
+runs again with WDRF in MCUSR, and the console drops the controller as if
+it had been unplugged.
+
+With -g a goal is sent to the scheduler (Schedule.c) over its vendor
+request before the run, as gadget/reader -g sends it to a controller. The
+run reports the plan the firmware took, next to the clears and drone runs
+the run reached.
+
+With -u a program for the EEPROM (route2c.py -p) is first uploaded over
+MACRO_REQUEST the way gadget/reader -u uploads it, part by part while the
+main loop writes each one. The controller is then power-cycled, and the
+run plays the tables of the program instead of the flash tables.
+
+With -S the run is saved after a poll, or after the poll that enters a
+step, and -R resumes a run from the snapshot: the rest of the route, the
+console model and the run's counts carry on as if it had never stopped.
+Every run resumed from one snapshot is a fork of the same prefix, so
+timing experiments on a later step (another program with -u, a goal with
+-g, another poll period, an interruption with -z) start from there instead
+of playing the route up to it again.
+
+Invariants checked:
+  - the route reaches DONE (or, when the plan never launches the drone,
+    closes its loop),
+  - every drone run starts after the number of clears the plan asks for,
+  - no Step.c table is read past its END entry,
+  - every processed frame fetches a fresh command instead of reusing tmp,
+  - with -m, every step leaves the console model (Console.c) on the
+    screen and item the next step expects (a step cut short by -z is only
+    listed as interrupted),
+  - with PRO_CONTROLLER, the Pro Controller handshake completes against
+    the host stand-in (ProHost.c), and every report decodes to the same
+    inputs, the IMU turning the camera as far as the right stick would.
+*/
+
+#define main Firmware_Main
+#include "../Joystick.c"
+#undef main
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "CameraPlan.h"
+#include "Console.h"
+#include "ProHost.h"
+
+// Stand-ins for the I/O registers and USB stack state.
+volatile uint8_t PORTB, PORTD, DDRB, DDRD, MCUSR;
+volatile uint8_t TCCR0A, TCCR0B, OCR0A, TIMSK0;
+volatile uint8_t USB_DeviceState = DEVICE_STATE_Configured;
+
+bool    Endpoint_ConfigureEndpoint(const uint8_t Address, const uint8_t Type, const uint16_t Size, const uint8_t Banks) { return true; }
+void    Endpoint_SelectEndpoint(const uint8_t Address) {}
+bool    Endpoint_IsOUTReceived(void) { return false; }
+uint16_t Endpoint_BytesInEndpoint(void) { return 0; }
+bool    Endpoint_IsINReady(void) { return true; }
+bool    Endpoint_IsReadWriteAllowed(void) { return true; }
+void    Endpoint_ClearOUT(void) {}
+void    Endpoint_ClearIN(void) {}
+uint8_t Endpoint_Read_Stream_LE(void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed) { return ENDPOINT_RWSTREAM_NoError; }
+uint8_t Endpoint_Write_Stream_LE(const void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed) { return ENDPOINT_RWSTREAM_NoError; }
+void    USB_Init(void) {}
+void    USB_USBTask(void) {}
+
+// Control requests are answered into a buffer, as the host would receive them.
+USB_Request_Header_t USB_ControlRequest;
+static uint8_t control_reply[1024];
+static uint16_t control_length;
+static bool control_handled;
+static const void* control_data; // the data stage of a request from the host
+
+void Endpoint_ClearSETUP(void) {
+	control_handled = true;
+}
+
+void Endpoint_ClearStatusStage(void) {}
+
+uint8_t Endpoint_Write_Control_Stream_LE(const void* const Buffer, uint16_t Length) {
+	if (Length > USB_ControlRequest.wLength) {
+		Length = USB_ControlRequest.wLength;
+	}
+	if (Length > sizeof(control_reply)) {
+		Length = sizeof(control_reply);
+	}
+	memcpy(control_reply, Buffer, Length);
+	control_length = Length;
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+uint8_t Endpoint_Write_Control_EStream_LE(const void* const Buffer, uint16_t Length) {
+	return Endpoint_Write_Control_Stream_LE(Buffer, Length);
+}
+
+uint8_t Endpoint_Read_Control_Stream_LE(void* const Buffer, uint16_t Length) {
+	if (Length > USB_ControlRequest.wLength) {
+		Length = USB_ControlRequest.wLength;
+	}
+	memcpy(Buffer, control_data, Length);
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+// Timer0's compare interrupt, fired once per simulated millisecond.
+void TIMER0_COMPA_vect(void);
+static double ticked_ms = 0;
+
+static void AdvanceClock(double now_ms) {
+	while (ticked_ms + 1 <= now_ms) {
+		TIMER0_COMPA_vect();
+		ticked_ms += 1;
+	}
+}
+
+static const char* const StepNames[] = {
+	"CONNECT_CONTROLLER",
+	"SYNC_CONTROLLER",
+	"GO_TO_ALTERNA",
+	"OPEN_OPTION",
+	"TURN_OFF_GYRO",
+	"SET_SENSITIVITY",
+	"JUMP_TO_STAGE",
+	"ENTER_STAGE",
+	"CLEAR_STAGE",
+	"LUNCH_DRONE",
+	"RESET_SENSITIVITY",
+	"RESET_GYRO_SETTING",
+	"BACK_TO_SPLATSVILLE",
+	"RECONNECT",
+};
+#define STEP_COUNT (sizeof(StepNames) / sizeof(StepNames[0]))
+
+#define MAX_VIOLATIONS 16
+static char violations[MAX_VIOLATIONS][160];
+static int violation_count = 0;
+
+static bool fetched = false;
+static double delayed_ms = 0;
+
+static void Violation(const char* format, ...) {
+	va_list args;
+
+	if (violation_count < MAX_VIOLATIONS) {
+		va_start(args, format);
+		vsnprintf(violations[violation_count], sizeof(violations[0]), format, args);
+		va_end(args);
+	}
+	violation_count++;
+}
+
+const void* SimStepAt(const void* table, size_t count, size_t elem, int index, const char* name) {
+	fetched = true;
+	if (index < 0 || (size_t)index >= count) {
+		Violation("%s read past END at index %ld", name, index);
+		index = count - 1;
+	}
+
+	return (const uint8_t*)table + index * elem;
+}
+
+void SimDelay(double ms) {
+	if (delayed_ms == 0) {
+		Violation("%s blocked the IN path for %g ms", StepNames[step], ms);
+	}
+	delayed_ms += ms;
+}
+
+// The engine's own stack, so the simulator's tracing and console model do
+// not show up in its depth.
+static ucontext_t sim_context, engine_context;
+static uint8_t engine_stack[65536];
+static USB_JoystickReport_Input_t* engine_report;
+static uint32_t engine_polls; // GetNextReport() calls since the engine started
+static double polled_ms;      // the clock at the last of them
+
+static void Engine(void) {
+	MemoryPaint();
+	for (;;) {
+		GetNextReport(engine_report);
+		swapcontext(&engine_context, &sim_context);
+	}
+}
+
+static void Poll(USB_JoystickReport_Input_t* report) {
+	engine_report = report;
+	engine_polls++;
+	polled_ms = ticked_ms;
+	swapcontext(&sim_context, &engine_context);
+}
+
+static void StartEngine(void) {
+	getcontext(&engine_context);
+	engine_context.uc_stack.ss_sp = engine_stack;
+	engine_context.uc_stack.ss_size = sizeof(engine_stack);
+	engine_context.uc_link = NULL;
+	makecontext(&engine_context, Engine, 0);
+	engine_polls = 0;
+}
+
+// The controller resets: everything but .noinit (the black box and the
+// recovery point) starts from its power-on value, and the firmware boots
+// again with the cause in MCUSR (WDRF for the watchdog, PORF for a power cycle).
+static void Reboot(uint8_t reset_cause) {
+	state = SYNC_POSITION;
+	step = CONNECT_CONTROLLER;
+	memset(&tmp, 0, sizeof(tmp));
+	echoes = 0;
+	memset(&last_report, 0, sizeof(last_report));
+	bufindex = 0;
+	duration_count = 0;
+	report_count = 0;
+	flag = 0;
+	mode = 0;
+	clear_count = 0;
+	drone_count = 0;
+	gyro_on = GYRO_SETTING;
+	sensitivity_val = SENSITIVITY * 2;
+	sensitivity_target = 0;
+	portsval = 0;
+	link_lost = 0;
+	reconnect_parts = 0;
+	resume_step = OPEN_OPTION;
+	resume_bufindex = 0;
+	packed_polls = 0;
+	recorded_state = 0xFF;
+	recorded_step = 0xFF;
+	progress = 0;
+	idle_frames = 0;
+	for (int id = 0; id < TASK_COUNT; id++) {
+		TaskStop(id);
+	}
+
+	MCUSR = reset_cause;
+	SetupHardware();
+	StartEngine();
+}
+
+// Ask the firmware for its memory usage with the vendor request a PC would send.
+static memory_usage QueryMemory(void) {
+	memory_usage usage = { 0, 0, 0, 0, 0 };
+
+	USB_ControlRequest = (USB_Request_Header_t){
+		.bmRequestType = REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE,
+		.bRequest      = MEMORY_REQUEST,
+		.wLength       = sizeof(usage),
+	};
+	control_handled = false;
+	control_length = 0;
+	EVENT_USB_Device_ControlRequest();
+
+	if (!control_handled || control_length != sizeof(usage)) {
+		Violation("%s was answered with %u bytes", "MEMORY_REQUEST", control_length);
+	}
+	memcpy(&usage, control_reply, control_length);
+	return usage;
+}
+
+// Send a goal to the scheduler and read back what it planned, as gadget/reader -g does.
+static bool SendGoal(const schedule_goal* goal, schedule_report* report) {
+	USB_ControlRequest = (USB_Request_Header_t){
+		.bmRequestType = REQDIR_HOSTTODEVICE | REQTYPE_VENDOR | REQREC_DEVICE,
+		.bRequest      = SCHEDULE_REQUEST,
+		.wLength       = sizeof(*goal),
+	};
+	control_data = goal;
+	control_handled = false;
+	EVENT_USB_Device_ControlRequest();
+	if (!control_handled) {
+		Violation("%s was not taken", "SCHEDULE_REQUEST");
+	}
+
+	USB_ControlRequest = (USB_Request_Header_t){
+		.bmRequestType = REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE,
+		.bRequest      = SCHEDULE_REQUEST,
+		.wLength       = sizeof(*report),
+	};
+	control_handled = false;
+	control_length = 0;
+	EVENT_USB_Device_ControlRequest();
+	if (!control_handled || control_length != sizeof(*report)) {
+		Violation("%s was answered with %u bytes", "SCHEDULE_REQUEST", control_length);
+		return false;
+	}
+	memcpy(report, control_reply, sizeof(*report));
+	return memcmp(&report->goal, goal, sizeof(*goal)) == 0;
+}
+
+static const char* const MacroStates[] = { "none", "active", "invalid", "writing", "ready" };
+
+static macro_status QueryMacro(void) {
+	macro_status status = { 0 };
+
+	USB_ControlRequest = (USB_Request_Header_t){
+		.bmRequestType = REQDIR_DEVICETOHOST | REQTYPE_VENDOR | REQREC_DEVICE,
+		.bRequest      = MACRO_REQUEST,
+		.wLength       = sizeof(status),
+	};
+	control_handled = false;
+	control_length = 0;
+	EVENT_USB_Device_ControlRequest();
+	if (!control_handled || control_length != sizeof(status)) {
+		Violation("%s was answered with %u bytes", "MACRO_REQUEST", control_length);
+	}
+	memcpy(&status, control_reply, control_length);
+	return status;
+}
+
+static bool SendMacro(uint16_t operation, uint16_t offset, const void* data, uint16_t length) {
+	USB_ControlRequest = (USB_Request_Header_t){
+		.bmRequestType = REQDIR_HOSTTODEVICE | REQTYPE_VENDOR | REQREC_DEVICE,
+		.bRequest      = MACRO_REQUEST,
+		.wValue        = offset,
+		.wIndex        = operation,
+		.wLength       = length,
+	};
+	control_data = data;
+	control_handled = false;
+	EVENT_USB_Device_ControlRequest();
+	return control_handled;
+}
+
+// The main loop writes the last part to EEPROM while the host waits for it.
+static macro_status WaitMacro(void) {
+	macro_status status;
+	for (long pass = 0; (status = QueryMacro()).busy && pass < 100000; pass++) {
+		TaskRun();
+	}
+	return status;
+}
+
+// The program uploaded by -u, kept for a snapshot of the run.
+static uint8_t program[MACRO_SIZE + 1];
+static uint16_t program_length;
+
+static bool ReadProgram(const char* path, char* why, size_t size) {
+	FILE* f = fopen(path, "rb");
+	if (!f) {
+		snprintf(why, size, "cannot open %s", path);
+		return false;
+	}
+	program_length = fread(program, 1, sizeof(program), f);
+	fclose(f);
+	return true;
+}
+
+// Upload the program as gadget/reader -u does: check that the firmware can
+// take it, write it part by part, then commit it and read the verdict.
+static bool UploadProgram(const char* path, char* why, size_t size) {
+	macro_header header;
+	uint16_t length = program_length;
+
+	macro_status status = WaitMacro();
+	memcpy(&header, program, sizeof(header));
+	if (length < sizeof(header) || length > status.size || header.version != status.version || header.route != status.route) {
+		snprintf(why, size, "%s is not a program for this firmware (route 0x%04X)", path, status.route);
+		return false;
+	}
+
+	for (size_t offset = 0; offset < length; offset += MACRO_CHUNK) {
+		uint16_t part = (length - offset < MACRO_CHUNK) ? length - offset : MACRO_CHUNK;
+		WaitMacro();
+		if (!SendMacro(MACRO_WRITE, offset, program + offset, part)) {
+			snprintf(why, size, "the write at %zu was stalled", offset);
+			return false;
+		}
+	}
+	WaitMacro();
+	if (!SendMacro(MACRO_COMMIT, 0, NULL, 0)) {
+		snprintf(why, size, "the commit was stalled");
+		return false;
+	}
+	status = WaitMacro();
+	if (status.state != MACRO_READY || status.written != length) {
+		snprintf(why, size, "the program is %s after the commit", MacroStates[status.state]);
+		return false;
+	}
+	return true;
+}
+
+// -g clears[,drone_runs]: the clears per drone run (a number, auto for
+// DRONE_CLEARS or forever), then the drone runs (0 for DRONE_RUNS).
+static bool ParseGoal(const char* text, schedule_goal* goal) {
+	unsigned runs = SCHEDULE_AUTO;
+	char clears[16];
+
+	int fields = sscanf(text, "%15[^,],%u", clears, &runs);
+	if (fields < 1 || runs > 255) {
+		return false;
+	}
+	*goal = (schedule_goal){
+		.magic      = SCHEDULE_MAGIC,
+		.version    = SCHEDULE_VERSION,
+		.drone_runs = runs,
+	};
+	if (strcmp(clears, "auto") == 0) {
+		goal->clears = SCHEDULE_AUTO;
+	} else if (strcmp(clears, "forever") == 0) {
+		goal->clears = SCHEDULE_FOREVER;
+	} else {
+		int n = atoi(clears);
+		if (n < 1 || n >= SCHEDULE_FOREVER) {
+			return false;
+		}
+		goal->clears = n;
+	}
+	return true;
+}
+
+static void TraceReport(long poll, Step_t before, const USB_JoystickReport_Input_t* report) {
+	const uint8_t* bytes = (const uint8_t*)report;
+
+	fprintf(stderr, "%ld %s %d", poll, StepNames[before], bufindex);
+	for (size_t i = 0; i < sizeof(*report); i++) {
+		fprintf(stderr, " %02x", bytes[i]);
+	}
+	fprintf(stderr, "\n");
+}
+
+static const char* const EventNames[] = { "EMPTY", "BOOT", "STEP", "GAP", "DISCONNECT", "RESUME" };
+#define EVENT_COUNT (sizeof(EventNames) / sizeof(EventNames[0]))
+
+// Put the engine in the state of a black box record.
+static void RestoreEntry(const blackbox_entry* entry) {
+	state = entry->state;
+	echoes = 0;
+	packed_polls = 0;
+	idle_frames = 0;
+	step = entry->step;
+	bufindex = entry->bufindex;
+	duration_count = entry->duration_count;
+	clear_count = entry->clear_count;
+	drone_count = entry->drone_count;
+	gyro_on = entry->gyro_on;
+	sensitivity_val = entry->sensitivity_val;
+	recorded_state = state;
+	recorded_step = step;
+}
+
+static bool SameState(const blackbox_entry* entry) {
+	return entry->state == state && entry->step == step && entry->bufindex == bufindex
+		&& entry->duration_count == duration_count && entry->clear_count == clear_count
+		&& entry->drone_count == drone_count && entry->gyro_on == gyro_on
+		&& entry->sensitivity_val == sensitivity_val;
+}
+
+static void ReplayPoll(long* poll, bool trace) {
+	USB_JoystickReport_Input_t report;
+	Step_t before = step;
+
+	Poll(&report);
+	if (trace) {
+		TraceReport(*poll, before, &report);
+	}
+	(*poll)++;
+}
+
+// Replay a black box. Every run of STEP records up to the next BOOT is one
+// segment: the engine starts from its first record, and must reach each
+// following record's state on exactly the recorded poll. A RESUME record
+// interrupts the engine on its poll, as the USB events or the gap did. A
+// segment cannot start in RECONNECT, whose plan is not recorded.
+static int ReplayBlackBox(const char* path, bool trace) {
+	blackbox_log log;
+	blackbox_entry entries[BLACKBOX_ENTRIES];
+	int count = 0, failed = 0, segments = 0;
+	FILE* f = fopen(path, "rb");
+
+	if (!f || fread(&log, 1, sizeof(log), f) != sizeof(log)) {
+		fprintf(stderr, "sim: cannot read a black box of %u bytes from %s\n", (unsigned)sizeof(log), path);
+		return 2;
+	}
+	fclose(f);
+	if (log.magic != BLACKBOX_MAGIC || log.size != BLACKBOX_ENTRIES || log.head >= BLACKBOX_ENTRIES) {
+		fprintf(stderr, "sim: %s is not a black box of this build (%d entries)\n", path, BLACKBOX_ENTRIES);
+		return 2;
+	}
+
+	// Oldest first.
+	for (int i = 0; i < BLACKBOX_ENTRIES; i++) {
+		blackbox_entry entry = log.entries[(log.head + i) % BLACKBOX_ENTRIES];
+		if (entry.event != BLACKBOX_EMPTY) {
+			entries[count++] = entry;
+		}
+	}
+
+	printf("{\"entries\": %d, \"reason\": \"%s\", \"dropped\": %u, \"events\": [",
+		count, log.reason < EVENT_COUNT ? EventNames[log.reason] : "?", log.dropped);
+	for (int i = 0, n = 0; i < count; i++) {
+		const blackbox_entry* e = &entries[i];
+		if (e->event == BLACKBOX_BOOT) {
+			printf("%s\n  \"BOOT (MCUSR 0x%02x)\"", n++ ? "," : "", e->gap);
+		} else if (e->event == BLACKBOX_RESUME) {
+			printf("%s\n  \"RESUME (LINK 0x%02x) at poll %lu, in %s %u\"", n++ ? "," : "", e->gap,
+				(unsigned long)e->poll, e->step < STEP_COUNT ? StepNames[e->step] : "?", e->bufindex);
+		} else if (e->event != BLACKBOX_STEP) {
+			printf("%s\n  \"%s at poll %lu after %u ms, in %s %u\"", n++ ? "," : "",
+				EventNames[e->event < EVENT_COUNT ? e->event : 0], (unsigned long)e->poll, e->gap,
+				e->step < STEP_COUNT ? StepNames[e->step] : "?", e->bufindex);
+		}
+	}
+	printf("], \"segments\": [");
+
+	for (int i = 0; i < count; ) {
+		while (i < count && (entries[i].event != BLACKBOX_STEP || entries[i].step == RECONNECT)) {
+			i++;
+		}
+		if (i == count) {
+			break;
+		}
+
+		const blackbox_entry* first = &entries[i++];
+		long poll = first->poll;
+		int steps = 1;
+		char mismatch[160] = "";
+		RestoreEntry(first);
+
+		for (; i < count && entries[i].event != BLACKBOX_BOOT && !mismatch[0]; i++) {
+			const blackbox_entry* next = &entries[i];
+			if (next->event == BLACKBOX_RESUME) {
+				while (poll < (long)next->poll) {
+					ReplayPoll(&poll, trace);
+				}
+				Resume(next->gap);
+				continue;
+			}
+			if (next->event != BLACKBOX_STEP) {
+				continue;
+			}
+
+			// The engine records a step change on the poll that makes its first frame.
+			// Records dropped while the ring was being saved leave changes unrecorded.
+			while ((log.dropped || !(echoes == 0 && (state != recorded_state || step != recorded_step))) && poll < (long)next->poll) {
+				ReplayPoll(&poll, trace);
+			}
+
+			if (poll != (long)next->poll || !SameState(next)) {
+				snprintf(mismatch, sizeof(mismatch), "recorded %s %u at poll %lu, replay is in %s %d at poll %ld",
+					next->step < STEP_COUNT ? StepNames[next->step] : "?", next->bufindex, (unsigned long)next->poll,
+					StepNames[step], bufindex, poll);
+			} else {
+				// The poll that makes the recorded step's first frame.
+				ReplayPoll(&poll, trace);
+				steps++;
+			}
+		}
+
+		printf("%s\n  {\"from_poll\": %lu, \"to_poll\": %ld, \"steps\": %d, \"mismatch\": ",
+			segments++ ? "," : "", (unsigned long)first->poll, poll, steps);
+		if (mismatch[0]) {
+			printf("\"%s\"}", mismatch);
+			failed++;
+		} else {
+			printf("null}");
+		}
+	}
+	printf("]}\n");
+
+	return failed ? 1 : 0;
+}
+
+#define MAX_INDEX 4096
+
+// Flatten the route into one timeline and print it as SeekIndex.c.
+// An entry is recorded whenever a processed frame starts a new command; the
+// index ends at DONE, or where the route returns to a state it has already
+// indexed (the loop of INFINITE_LOOP_MODE).
+static int EmitIndex(long max_polls) {
+	static seek_entry entries[MAX_INDEX];
+	uint16_t count = 0;
+	uint32_t frame = 0;
+	uint32_t loop_frame = SEEK_NO_LOOP;
+	int last_step = -1, last_bufindex = -1;
+
+	for (long polls = 0; polls < max_polls && state != DONE; polls++) {
+		USB_JoystickReport_Input_t report;
+
+		if (echoes == 0 && state == PROCESS) {
+			if (step != last_step || bufindex != last_bufindex) {
+				seek_entry entry = {
+					.frame           = frame,
+					.duration_count  = duration_count,
+					.step            = step,
+					.bufindex        = bufindex,
+					.clear_count     = clear_count,
+					.drone_count     = drone_count,
+					.gyro_on         = gyro_on,
+					.sensitivity_val = sensitivity_val,
+				};
+
+				for (uint16_t i = 0; i < count; i++) {
+					seek_entry seen = entries[i];
+					seen.frame = frame;
+					if (memcmp(&seen, &entry, sizeof(entry)) == 0) {
+						loop_frame = entries[i].frame;
+						break;
+					}
+				}
+				if (loop_frame != SEEK_NO_LOOP) {
+					break;
+				}
+				if (count == MAX_INDEX) {
+					fprintf(stderr, "sim: route needs more than %d index entries\n", MAX_INDEX);
+					return 1;
+				}
+
+				entries[count++] = entry;
+				last_step = step;
+				last_bufindex = bufindex;
+			}
+			frame++;
+		}
+
+		GetNextReport(&report);
+	}
+
+	if (state != DONE && loop_frame == SEEK_NO_LOOP) {
+		fprintf(stderr, "sim: route neither reached DONE nor looped within %ld polls\n", max_polls);
+		return 1;
+	}
+
+	printf("/* Generated by `make -C sim index` from Step.c and Config.h. Do not edit. */\n\n");
+	printf("#include \"SeekIndex.h\"\n\n");
+	printf("const seek_entry SeekIndex[] PROGMEM = {\n");
+	for (uint16_t i = 0; i < count; i++) {
+		seek_entry e = entries[i];
+		printf("\t{ %6lu, %3u, %2u, %3u, %u, %u, %u, %3d }, // %s\n",
+			(unsigned long)e.frame, e.duration_count, e.step, e.bufindex,
+			e.clear_count, e.drone_count, e.gyro_on, e.sensitivity_val, StepNames[e.step]);
+	}
+	printf("};\n");
+	printf("const uint16_t SeekIndexSize = %u;\n\n", count);
+
+	printf("const uint16_t SeekPhaseStart[] PROGMEM = {\n");
+	for (size_t phase = 0; phase < STEP_COUNT; phase++) {
+		uint16_t start = SEEK_NONE;
+		for (uint16_t i = 0; i < count; i++) {
+			if (entries[i].step == phase) {
+				start = i;
+				break;
+			}
+		}
+		if (start == SEEK_NONE) {
+			printf("\tSEEK_NONE, // %s\n", StepNames[phase]);
+		} else {
+			printf("\t%9u, // %s\n", start, StepNames[phase]);
+		}
+	}
+	printf("};\n");
+	printf("const uint8_t SeekPhaseCount = %u;\n\n", (unsigned)STEP_COUNT);
+
+	printf("const uint32_t SeekEndFrame = %lu;\n", (unsigned long)frame);
+	if (loop_frame == SEEK_NO_LOOP) {
+		printf("const uint32_t SeekLoopFrame = SEEK_NO_LOOP;\n");
+	} else {
+		printf("const uint32_t SeekLoopFrame = %lu;\n", (unsigned long)loop_frame);
+	}
+
+	return 0;
+}
+
+// Print the camera plan of a turn for every in-game sensitivity.
+static int PrintCameraPlans(const char* turn) {
+	int yaw, pitch;
+
+	if (sscanf(turn, "%d,%d", &yaw, &pitch) != 2) {
+		fprintf(stderr, "sim: -c expects yaw,pitch in hundredths of a degree\n");
+		return 2;
+	}
+
+	printf("{\"yaw\": %d, \"pitch\": %d, \"plans\": [", yaw, pitch);
+	for (int s = CAMERA_SENSITIVITY_MIN; s <= CAMERA_SENSITIVITY_MAX; s++) {
+		camera_move move = CameraPlan(yaw, pitch, s);
+		printf("%s\n  {\"sensitivity\": %.1f, \"frames\": %u, \"dx\": %d, \"dy\": %d, \"yaw\": %.3f, \"pitch\": %.3f}",
+			s > CAMERA_SENSITIVITY_MIN ? "," : "", s / 2.0, move.frames, move.dx, move.dy, move.yaw / 1000.0, move.pitch / 1000.0);
+	}
+	printf("\n]}\n");
+
+	return 0;
+}
+
+#define MAX_LANDINGS 64
+
+// The rewards a run counts: stage clears and drone runs.
+enum { REWARD_CLEAR, REWARD_DRONE, REWARD_COUNT };
+
+// What a run has counted so far.
+typedef struct {
+	long phase_polls[STEP_COUNT];
+	long stale[STEP_COUNT];
+	long loop_start[2];
+	int  loop_count;
+	// Rewards from the first super jump (or, when the drone is never launched,
+	// the first stage entry of the loop) to the last clear or drone run.
+	long rewards[REWARD_COUNT];
+	long reward_from, reward_to;
+	char landings[MAX_LANDINGS][96];
+	int  landing_count;
+	long pro_mismatches;
+	int  idle_max;         // the most frames the engine made in a row without playing the route
+	Step_t idle_step;      // where it did
+} sim_run;
+
+// A run between two polls, as -S saves it and -R resumes it: the engine's
+// globals field by field, the firmware's other state as far as it is public
+// or set over its vendor requests, the console model and the run's counts.
+// It is only read back by a simulator built from the same route and switches.
+#define SNAPSHOT_MAGIC 0x50414E53 // "SNAP"
+
+// The route and the switches a snapshot must be resumed with (SnapshotBuild()).
+#define SNAPSHOT_BUILD "ROUTE_SIGNATURE=0x%04X INFINITE_LOOP_MODE=%d DRONE_CLEARS=%d DRONE_RUNS=%d GYRO_SETTING=%d " \
+	"SENSITIVITY=%d REVERSE_LR=%d REVERSE_UD=%d SOFT_TYPE=%d PRO_CONTROLLER=%d FAST_MENUS=%d EARLY_HOLD_CREDIT=%d"
+#define SNAPSHOT_BUILD_VALUES 12 // conversions in SNAPSHOT_BUILD, each at most 11 characters ("-2147483648")
+
+typedef struct {
+	uint32_t magic;
+	uint32_t size;            // sizeof(sim_snapshot)
+	char     build[sizeof(SNAPSHOT_BUILD) + SNAPSHOT_BUILD_VALUES * 11];
+
+	// Joystick.c
+	State_t  state;
+	Step_t   step;
+	command  tmp;
+	int      echoes;
+	USB_JoystickReport_Input_t last_report;
+	int      bufindex;
+	int      duration_count;
+	int      report_count;
+	int      flag;
+	int      mode;
+	int      clear_count;
+	int      drone_count;
+	int      gyro_on;
+	int      sensitivity_set;
+	int      sensitivity_val;
+	int      sensitivity_target;
+	int      portsval;
+	uint8_t  link_lost;
+	uint8_t  reconnect_parts;
+	Step_t   resume_step;
+	int      resume_bufindex;
+	command  packed;
+	Step_t   packed_step;
+	uint16_t packed_polls;
+	recovery_point recovery;
+	uint8_t  recorded_state;
+	uint8_t  recorded_step;
+	uint8_t  progress;
+	uint8_t  idle_frames;
+	uint8_t  portb, portd;
+
+	// The black box, the scheduler's goal and the program of -u.
+	blackbox_log blackbox;       // BlackBoxLog
+	blackbox_log blackbox_saved; // BlackBoxSaved in EEPROM
+	uint32_t engine_polls;       // BlackBoxPoll() calls since the controller booted
+	double   polled_ms;          // the clock at the last of them
+	schedule_goal goal;
+	uint8_t  program[MACRO_SIZE + 1];
+	uint16_t program_length;
+	uint16_t stack;              // the deepest stack of the engine so far
+
+	// The host and the run.
+	double   clock_ms;           // ticked_ms
+	double   next_ms;            // when the next poll is made
+	long     polls;
+	bool     model;
+	uint8_t  console[CONSOLE_SNAPSHOT_SIZE];
+	sim_run  run;
+	char     violations[MAX_VIOLATIONS][160];
+	int      violation_count;
+	double   delayed_ms;
+} sim_snapshot;
+
+// The route and the switches a snapshot must be resumed with. A build string
+// that does not fit would let snapshots of other switches pass for ours.
+static void SnapshotBuild(char* build, size_t size) {
+	int length = snprintf(build, size, SNAPSHOT_BUILD,
+		ROUTE_SIGNATURE, INFINITE_LOOP_MODE, DRONE_CLEARS, DRONE_RUNS, GYRO_SETTING,
+		SENSITIVITY, REVERSE_LR, REVERSE_UD, SOFT_TYPE, PRO_CONTROLLER, FAST_MENUS, EARLY_HOLD_CREDIT);
+
+	if (length < 0 || (size_t)length >= size) {
+		fprintf(stderr, "sim: the build of a snapshot needs %d bytes, it has %u\n", length + 1, (unsigned)size);
+		exit(2);
+	}
+}
+
+static void TakeSnapshot(sim_snapshot* s, long polls, double next_ms, bool model, const sim_run* run) {
+	memset(s, 0, sizeof(*s));
+	s->magic = SNAPSHOT_MAGIC;
+	s->size = sizeof(*s);
+	SnapshotBuild(s->build, sizeof(s->build));
+
+	s->state = state;
+	s->step = step;
+	s->tmp = tmp;
+	s->echoes = echoes;
+	s->last_report = last_report;
+	s->bufindex = bufindex;
+	s->duration_count = duration_count;
+	s->report_count = report_count;
+	s->flag = flag;
+	s->mode = mode;
+	s->clear_count = clear_count;
+	s->drone_count = drone_count;
+	s->gyro_on = gyro_on;
+	s->sensitivity_set = sensitivity_set;
+	s->sensitivity_val = sensitivity_val;
+	s->sensitivity_target = sensitivity_target;
+	s->portsval = portsval;
+	s->link_lost = link_lost;
+	s->reconnect_parts = reconnect_parts;
+	s->resume_step = resume_step;
+	s->resume_bufindex = resume_bufindex;
+	s->packed = packed;
+	s->packed_step = packed_step;
+	s->packed_polls = packed_polls;
+	s->recovery = recovery;
+	s->recorded_state = recorded_state;
+	s->recorded_step = recorded_step;
+	s->progress = progress;
+	s->idle_frames = idle_frames;
+	s->portb = PORTB;
+	s->portd = PORTD;
+
+	s->blackbox = BlackBoxLog;
+	s->blackbox_saved = BlackBoxSaved;
+	s->engine_polls = engine_polls;
+	s->polled_ms = polled_ms;
+	s->goal = ScheduleReport().goal;
+	memcpy(s->program, program, sizeof(program));
+	s->program_length = program_length;
+	s->stack = engine_polls ? QueryMemory().stack : 0; // the engine paints its stack on its first poll
+
+	s->clock_ms = ticked_ms;
+	s->next_ms = next_ms;
+	s->polls = polls;
+	s->model = model && ConsoleSave(s->console, sizeof(s->console));
+	s->run = *run;
+	memcpy(s->violations, violations, sizeof(violations));
+	s->violation_count = violation_count;
+	s->delayed_ms = delayed_ms;
+}
+
+static bool WriteSnapshot(const char* path, const sim_snapshot* s) {
+	FILE* f = fopen(path, "wb");
+	if (!f || fwrite(s, sizeof(*s), 1, f) != 1) {
+		perror(path);
+		return false;
+	}
+	fclose(f);
+	return true;
+}
+
+static bool ReadSnapshot(const char* path, sim_snapshot* s) {
+	char build[sizeof(s->build)];
+	FILE* f = fopen(path, "rb");
+
+	if (!f || fread(s, 1, sizeof(*s), f) != sizeof(*s)) {
+		fprintf(stderr, "sim: cannot read a snapshot of %u bytes from %s\n", (unsigned)sizeof(*s), path);
+		return false;
+	}
+	fclose(f);
+	SnapshotBuild(build, sizeof(build));
+	if (s->magic != SNAPSHOT_MAGIC || s->size != sizeof(*s) || strcmp(s->build, build) != 0) {
+		fprintf(stderr, "sim: %s is not a snapshot of this build (%s)\n", path, build);
+		return false;
+	}
+	return true;
+}
+
+// Put the controller, powered on and past the handshake, back in the state
+// of a snapshot. The firmware's clock and the black box's count of polls
+// are run forward to where they were; the rest of its private state (the
+// order the tasks take turns in, a goal or a black box being saved) starts
+// over, which only moves the EEPROM writes to other passes of the main loop.
+static void RestoreSnapshot(const sim_snapshot* s) {
+	AdvanceClock(s->polled_ms);
+	for (uint32_t i = 0; i < s->engine_polls; i++) {
+		BlackBoxPoll();
+	}
+	engine_polls = s->engine_polls;
+	polled_ms = s->polled_ms;
+	AdvanceClock(s->clock_ms);
+
+	state = s->state;
+	step = s->step;
+	tmp = s->tmp;
+	echoes = s->echoes;
+	last_report = s->last_report;
+	bufindex = s->bufindex;
+	duration_count = s->duration_count;
+	report_count = s->report_count;
+	flag = s->flag;
+	mode = s->mode;
+	clear_count = s->clear_count;
+	drone_count = s->drone_count;
+	gyro_on = s->gyro_on;
+	sensitivity_set = s->sensitivity_set;
+	sensitivity_val = s->sensitivity_val;
+	sensitivity_target = s->sensitivity_target;
+	portsval = s->portsval;
+	link_lost = s->link_lost;
+	reconnect_parts = s->reconnect_parts;
+	resume_step = s->resume_step;
+	resume_bufindex = s->resume_bufindex;
+	packed = s->packed;
+	packed_step = s->packed_step;
+	packed_polls = s->packed_polls;
+	recovery = s->recovery;
+	recorded_state = s->recorded_state;
+	recorded_step = s->recorded_step;
+	progress = s->progress;
+	idle_frames = s->idle_frames;
+	PORTB = s->portb;
+	PORTD = s->portd;
+
+	BlackBoxLog = s->blackbox;
+	BlackBoxLog.saving = 0;
+	BlackBoxSaved = s->blackbox_saved;
+	if (s->blackbox.saving) {
+		BlackBoxSave(s->blackbox.reason);
+	}
+	schedule_report schedule = ScheduleReport();
+	if (memcmp(&schedule.goal, &s->goal, sizeof(s->goal)) != 0) {
+		ScheduleSet(&s->goal);
+	}
+
+	if (s->model) {
+		ConsoleLoad(s->console);
+	}
+	delayed_ms = s->delayed_ms;
+
+	// What went wrong on the way here (the upload, the handshake) follows the snapshot's violations.
+	static char found[MAX_VIOLATIONS][160];
+	int found_count = violation_count;
+	memcpy(found, violations, sizeof(violations));
+	memcpy(violations, s->violations, sizeof(violations));
+	violation_count = s->violation_count;
+	for (int i = 0; i < found_count; i++) {
+		Violation("%s", i < MAX_VIOLATIONS ? found[i] : "");
+	}
+}
+
+static void usage(void) {
+	fprintf(stderr,
+		"usage: sim [-t] [-m] [-p poll_ms] [-n max_polls] [-l loops] [-s frame] [-z poll,ms[,how]] [-b blackbox] [-g goal] [-u program]\n"
+		"           [-S poll|STEP,snapshot] [-R snapshot]\n"
+		"       sim -i\n"
+		"       sim -c yaw,pitch\n"
+		"       sim [-t] -r blackbox\n"
+		"  -t  trace every poll (step, bufindex and report bytes) to stderr\n"
+		"  -m  play the reports into the console model and check where every step lands\n"
+		"  -p  host poll period in milliseconds (default 8)\n"
+		"  -n  give up after this many polls (default 2000000)\n"
+		"  -l  loops to run when the plan never launches the drone (default 3)\n"
+		"  -s  seek to this route frame before polling (needs the generated index)\n"
+		"  -i  print the route's frame-offset index as SeekIndex.c\n"
+		"  -c  print the camera plan of a turn (hundredths of a degree) for every sensitivity\n"
+		"  -z  the host stops polling for ms milliseconds after this poll; how is gap (default),\n"
+		"      sleep (USB suspend), unplug or reset (the watchdog), all followed by a new enumeration\n"
+		"  -b  write the firmware's black box to this file at the end of the run\n"
+		"  -r  replay a black box read from a controller (reader -b)\n"
+		"  -g  send the scheduler a goal first: clears[,drone_runs], the clears per drone run\n"
+		"      (a number, auto or forever), then the drone runs (0 for DRONE_RUNS)\n"
+		"  -u  upload a program (route2c.py -p) to the EEPROM first, then power-cycle\n"
+		"  -S  save the run after this poll, or after the poll that enters this step (e.g. CLEAR_STAGE)\n"
+		"  -R  resume the run saved by -S; -u, -g, -p and a later -z change what follows\n");
+}
+
+int main(int argc, char* argv[]) {
+	bool trace = false;
+	double poll_ms = 8.0;
+	long max_polls = 2000000;
+	int loops = 3;
+	long seek = -1;
+	bool index = false;
+	const char* turn = NULL;
+	bool model = false;
+	const char* blackbox_out = NULL;
+	const char* replay = NULL;
+	long stall_poll = -1;
+	double stall_ms = 0;
+	char stall_how[16] = "gap";
+	const char* goal_text = NULL;
+	const char* program_path = NULL;
+	long save_poll = -1;
+	int save_step = -1;
+	char save_path[256] = "";
+	const char* resume_path = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "tmp:n:l:s:ic:z:b:r:g:u:S:R:h")) != -1) {
+		switch (opt) {
+			case 't': trace = true; break;
+			case 'm': model = true; break;
+			case 'p': poll_ms = atof(optarg); break;
+			case 'n': max_polls = atol(optarg); break;
+			case 'l': loops = atoi(optarg); break;
+			case 's': seek = atol(optarg); break;
+			case 'i': index = true; break;
+			case 'c': turn = optarg; break;
+			case 'b': blackbox_out = optarg; break;
+			case 'r': replay = optarg; break;
+			case 'g': goal_text = optarg; break;
+			case 'u': program_path = optarg; break;
+			case 'R': resume_path = optarg; break;
+			case 'S': {
+				char where[32];
+				if (sscanf(optarg, "%31[^,],%255s", where, save_path) != 2) {
+					usage();
+					return 2;
+				}
+				for (size_t i = 0; i < STEP_COUNT; i++) {
+					if (strcmp(where, StepNames[i]) == 0) {
+						save_step = i;
+					}
+				}
+				char* end;
+				if (save_step < 0 && ((save_poll = strtol(where, &end, 10)) < 0 || *end)) {
+					usage();
+					return 2;
+				}
+				break;
+			}
+			case 'z':
+				if (sscanf(optarg, "%ld,%lf,%15s", &stall_poll, &stall_ms, stall_how) < 2
+					|| (strcmp(stall_how, "gap") && strcmp(stall_how, "sleep") && strcmp(stall_how, "unplug") && strcmp(stall_how, "reset"))) {
+					usage();
+					return 2;
+				}
+				break;
+			default: usage(); return 2;
+		}
+	}
+
+	// The controller is powered on.
+	MCUSR = 1 << PORF;
+	SetupHardware();
+	StartEngine();
+
+	if (index) {
+		return EmitIndex(max_polls);
+	}
+	if (turn) {
+		return PrintCameraPlans(turn);
+	}
+	if (replay) {
+		return ReplayBlackBox(replay, trace);
+	}
+
+	static sim_snapshot snapshot;
+	if (resume_path) {
+		if (seek >= 0) {
+			fprintf(stderr, "sim: a resumed run cannot also seek\n");
+			return 2;
+		}
+		if (!ReadSnapshot(resume_path, &snapshot)) {
+			return 2;
+		}
+		if (model && !snapshot.model) {
+			fprintf(stderr, "sim: %s was saved without the console model (-m)\n", resume_path);
+			return 2;
+		}
+		if (stall_poll >= 0 && stall_poll < snapshot.polls) {
+			fprintf(stderr, "sim: %s resumes after poll %ld\n", resume_path, snapshot.polls - 1);
+			return 2;
+		}
+		// The run goes on with the program it had, unless -u uploads another one.
+		if (!program_path && snapshot.program_length) {
+			memcpy(program, snapshot.program, sizeof(program));
+			program_length = snapshot.program_length;
+		}
+	}
+
+	// The program is uploaded on a PC; the controller is then plugged into the console.
+	if (program_path || program_length) {
+		char why[160];
+		if ((program_path && !ReadProgram(program_path, why, sizeof(why)))
+			|| !UploadProgram(program_path ? program_path : resume_path, why, sizeof(why))) {
+			Violation("upload: %s", why);
+		}
+		Reboot(1 << PORF);
+	}
+
+	if (model) {
+		ConsoleInit(START_AT_KETTLE);
+	}
+
+	#if PRO_CONTROLLER
+	// The console enumerates the controller and runs the handshake before it polls for inputs.
+	char pro_why[160];
+	EVENT_USB_Device_ConfigurationChanged();
+	if (!ProHostConnect(pro_why, sizeof(pro_why))) {
+		Violation("Pro Controller handshake: %s", pro_why);
+	}
+	#endif
+
+	sim_run run = {
+		.loop_start = { -1, -1 },
+		.reward_from = -1,
+		.reward_to = -1,
+	};
+	long polls = 0;
+	// Polls are made every poll_ms from the first one; a resumed run carries on from the snapshot.
+	long base_polls = 0;
+	double base_ms = 0;
+	if (resume_path) {
+		RestoreSnapshot(&snapshot);
+		run = snapshot.run;
+		polls = base_polls = snapshot.polls;
+		base_ms = snapshot.next_ms;
+	}
+
+	if (goal_text) {
+		schedule_goal goal;
+		schedule_report report;
+		if (!ParseGoal(goal_text, &goal)) {
+			usage();
+			return 2;
+		}
+		if (!SendGoal(&goal, &report)) {
+			Violation("the scheduler did not take the goal %s", goal_text);
+		}
+	}
+
+	if (model && seek >= 0) {
+		fprintf(stderr, "sim: the console model starts at the beginning of the route and cannot follow -s\n");
+		return 2;
+	}
+	if (seek >= 0 && !SeekFrame(seek)) {
+		fprintf(stderr, "sim: cannot seek to frame %ld (was the index generated?)\n", seek);
+		return 2;
+	}
+
+	bool done = false;
+	bool forever = (SchedulePlan.clears == SCHEDULE_FOREVER);
+
+	for (; polls < max_polls; polls++) {
+		USB_JoystickReport_Input_t report;
+		bool processed = (echoes == 0 && state == PROCESS);
+		Step_t before = step;
+		double now_ms = base_ms + (polls - base_polls) * poll_ms + (stall_poll >= 0 && polls > stall_poll ? stall_ms : 0);
+
+		AdvanceClock(now_ms);
+		fetched = false;
+		Poll(&report);
+		TaskRun();
+
+		if (trace) {
+			TraceReport(polls, before, &report);
+		}
+
+		#if PRO_CONTROLLER
+		if (!ProHostCheck(&report, pro_why, sizeof(pro_why)) && run.pro_mismatches++ == 0) {
+			Violation("poll %ld as a Pro Controller: %s", polls, pro_why);
+		}
+		#endif
+
+		if (model) {
+			ConsoleFeed(&report, before, now_ms);
+			if (step != before || state == DONE) {
+				char why[128];
+				bool interrupted = (step == RECONNECT && before != RECONNECT);
+				if (!interrupted && !ConsoleEndOfStep(before, why, sizeof(why))) {
+					Violation("%s %s", StepNames[before], why);
+				}
+				if (run.landing_count < MAX_LANDINGS) {
+					snprintf(run.landings[run.landing_count++], sizeof(run.landings[0]), "%s: %s%s", StepNames[before],
+						interrupted ? "interrupted at " : "", ConsoleWhere());
+				}
+			}
+		}
+
+		run.phase_polls[before]++;
+		if (idle_frames > run.idle_max) {
+			run.idle_max = idle_frames;
+			run.idle_step = before;
+		}
+		// A poll that resumed the route made the neutral report of SYNC_POSITION instead.
+		if (processed && !fetched && state != BREATHE) {
+			run.stale[before]++;
+		}
+
+		// The host stops polling after this poll. A console that sleeps or is
+		// unplugged also drops the controller, and enumerates it again when it is back.
+		if (polls == stall_poll) {
+			bool dropped = (strcmp(stall_how, "gap") != 0);
+			bool asleep = (strcmp(stall_how, "sleep") == 0);
+			if (dropped) {
+				if (asleep) {
+					EVENT_USB_Device_Suspend();
+				} else if (strcmp(stall_how, "reset") == 0) {
+					Reboot(1 << WDRF);
+				} else {
+					EVENT_USB_Device_Disconnect();
+				}
+				if (model) {
+					ConsoleDisconnect(asleep ? stall_ms : 0);
+				}
+			}
+			// The main loop keeps running its tasks in the meantime.
+			for (double t = now_ms + 1; t < now_ms + poll_ms + stall_ms; t += 1) {
+				AdvanceClock(t);
+				TaskRun();
+			}
+			if (dropped) {
+				EVENT_USB_Device_ConfigurationChanged();
+				#if PRO_CONTROLLER
+				if (!ProHostConnect(pro_why, sizeof(pro_why))) {
+					Violation("Pro Controller handshake after the %s: %s", stall_how, pro_why);
+				}
+				#endif
+			}
+		}
+
+		if (step != before && step == (forever ? ENTER_STAGE : JUMP_TO_STAGE) && run.reward_from < 0) {
+			run.reward_from = polls + 1;
+		}
+		if (step != before && step != RECONNECT && (before == CLEAR_STAGE || before == LUNCH_DRONE)) {
+			run.rewards[before == CLEAR_STAGE ? REWARD_CLEAR : REWARD_DRONE]++;
+			run.reward_to = polls + 1;
+		}
+		if (step != before && step == LUNCH_DRONE && clear_count != SchedulePlan.clears) {
+			Violation("the drone was launched after %d clears, the plan asks for %u", clear_count, SchedulePlan.clears);
+		}
+
+		if (step != before && step == ENTER_STAGE && clear_count == 0 && before != RECONNECT) {
+			run.loop_start[0] = run.loop_start[1];
+			run.loop_start[1] = polls + 1;
+			if (forever && ++run.loop_count > loops) {
+				break;
+			}
+		}
+
+		if (state == DONE) {
+			polls++;
+			done = true;
+			break;
+		}
+
+		// -S: the run is saved after this poll, or after the poll that enters the step.
+		if (save_path[0] && (polls == save_poll || (step != before && step == save_step))) {
+			double next_ms = base_ms + (polls + 1 - base_polls) * poll_ms + (stall_poll >= 0 && polls + 1 > stall_poll ? stall_ms : 0);
+			TakeSnapshot(&snapshot, polls + 1, next_ms, model, &run);
+			if (!WriteSnapshot(save_path, &snapshot)) {
+				return 2;
+			}
+			save_path[0] = '\0';
+		}
+	}
+
+	// The Switch keeps polling after the route is done; the controller must
+	// keep answering on time while its tasks (the alert) run.
+	if (done) {
+		int ports = PORTD;
+		long toggles = 0;
+		for (long i = 0; i < 1000 / poll_ms; i++) {
+			USB_JoystickReport_Input_t report;
+			AdvanceClock(base_ms + (polls + i - base_polls) * poll_ms);
+			Poll(&report);
+			TaskRun();
+			toggles += (PORTD != ports);
+			ports = PORTD;
+		}
+		#ifdef ALERT_WHEN_DONE
+		if (toggles < 2) {
+			Violation("the alert toggled %ld times in the second after DONE", toggles);
+		}
+		#endif
+	}
+
+	for (size_t i = 0; i < STEP_COUNT; i++) {
+		if (run.stale[i]) {
+			Violation("%s reused a stale tmp on %ld frames", StepNames[i], run.stale[i]);
+		}
+	}
+	// HID_Task() stops kicking the watchdog past ENGINE_IDLE_FRAMES.
+	if (run.idle_max > ENGINE_IDLE_FRAMES) {
+		Violation("%s made %d frames in a row without playing the route, the watchdog would reset the controller",
+			StepNames[run.idle_step], run.idle_max);
+	}
+
+	memory_usage memory = QueryMemory();
+	if (resume_path && snapshot.stack > memory.stack) {
+		memory.stack = snapshot.stack;
+	}
+
+	if (blackbox_out) {
+		FILE* f = fopen(blackbox_out, "wb");
+		if (!f || fwrite(&BlackBoxLog, sizeof(BlackBoxLog), 1, f) != 1) {
+			perror(blackbox_out);
+			return 2;
+		}
+		fclose(f);
+	}
+
+	long cycle_polls = polls;
+	if (forever) {
+		if (run.loop_count > loops && run.loop_start[0] >= 0) {
+			cycle_polls = run.loop_start[1] - 1 - run.loop_start[0];
+		} else {
+			Violation("%s never closed its loop within %ld polls", "CLEAR_STAGE", max_polls);
+		}
+	} else if (!done) {
+		Violation("%s never reached DONE within %ld polls", StepNames[step], max_polls);
+	}
+
+	printf("{\"config\": {\"INFINITE_LOOP_MODE\": %d, \"DRONE_CLEARS\": %d, \"DRONE_RUNS\": %d, \"GYRO_SETTING\": %d, \"SENSITIVITY\": %d, "
+		"\"REVERSE_LR\": %d, \"REVERSE_UD\": %d, \"SOFT_TYPE\": %d, \"PRO_CONTROLLER\": %d, \"FAST_MENUS\": %d, \"EARLY_HOLD_CREDIT\": %d, \"START_AT_KETTLE\": %d}, ",
+		INFINITE_LOOP_MODE, DRONE_CLEARS, DRONE_RUNS, GYRO_SETTING, SENSITIVITY, REVERSE_LR, REVERSE_UD, SOFT_TYPE,
+		PRO_CONTROLLER, FAST_MENUS, EARLY_HOLD_CREDIT, START_AT_KETTLE);
+	printf("\"done\": %s, \"polls\": %ld, \"cycle_polls\": %ld, \"cycle_seconds\": %.3f, \"delay_ms\": %.0f, ",
+		done ? "true" : "false", polls, cycle_polls, cycle_polls * poll_ms / 1000.0, delayed_ms);
+	printf("\"phases\": {");
+	for (size_t i = 0; i < STEP_COUNT; i++) {
+		printf("%s\"%s\": %ld", i ? ", " : "", StepNames[i], run.phase_polls[i]);
+	}
+	printf("}, ");
+	printf("\"memory\": {\"stack\": %u}, ", memory.stack);
+	schedule_report schedule = ScheduleReport();
+	double reward_hours = (run.reward_to - run.reward_from) * poll_ms / 3600000.0;
+	printf("\"schedule\": {\"goal\": %s, \"clears\": ", schedule.goal.magic == SCHEDULE_MAGIC ? "true" : "false");
+	if (schedule.plan.clears == SCHEDULE_FOREVER) {
+		printf("\"forever\"");
+	} else {
+		printf("%u", schedule.plan.clears);
+	}
+	printf(", \"drone_runs\": %u, ", schedule.plan.drone_runs);
+	printf("\"rewards\": [%ld, %ld], \"per_hour\": ", run.rewards[REWARD_CLEAR], run.rewards[REWARD_DRONE]);
+	if (run.reward_from >= 0 && run.reward_to > run.reward_from) {
+		printf("[%.1f, %.1f]}, ", run.rewards[REWARD_CLEAR] / reward_hours, run.rewards[REWARD_DRONE] / reward_hours);
+	} else {
+		printf("null}, ");
+	}
+	#if PRO_CONTROLLER
+	printf("\"pro\": {\"mismatches\": %ld}, ", run.pro_mismatches);
+	#endif
+	if (model) {
+		printf("\"console\": {\"dropped\": %ld, \"landings\": [", ConsoleDropped());
+		for (int i = 0; i < run.landing_count; i++) {
+			printf("%s\"%s\"", i ? ", " : "", run.landings[i]);
+		}
+		printf("]}, ");
+	}
+	macro_status macro = QueryMacro();
+	printf("\"macro\": {\"state\": \"%s\", \"tables\": %u}, ", MacroStates[macro.state], macro.tables);
+	printf("\"violations\": [");
+	for (int i = 0; i < violation_count && i < MAX_VIOLATIONS; i++) {
+		printf("%s\"%s\"", i ? ", " : "", violations[i]);
+	}
+	printf("]}\n");
+
+	return violation_count ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+/* Hooks forced into every translation unit of the simulator build (-include SimHooks.h). */
+
+#ifndef _SIM_HOOKS_H_
+#define _SIM_HOOKS_H_
+
+#include <stddef.h>
+
+// Bounds-checked table access. Reads past the end of a Step.c table are
+// recorded as invariant violations and answered with the table's last entry.
+const void* SimStepAt(const void* table, size_t count, size_t elem, int index, const char* name);
+
+#define STEP_AT(table, count, index) \
+	((__typeof__(&(table)[0]))SimStepAt((table), (count), sizeof((table)[0]), (index), __func__))
+
+#endif
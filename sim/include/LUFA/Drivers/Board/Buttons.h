@@ -0,0 +1 @@
+/* Host stand-in for <LUFA/Drivers/Board/Buttons.h>: no board drivers are simulated. */
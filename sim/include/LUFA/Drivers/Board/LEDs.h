@@ -0,0 +1 @@
+/* Host stand-in for <LUFA/Drivers/Board/LEDs.h>: no board drivers are simulated. */
@@ -0,0 +1,244 @@
+/* Host stand-in for <LUFA/Drivers/USB/USB.h>.
+ *
+ * Only the parts of the LUFA device API that the firmware touches are
+ * declared here. The endpoint functions are implemented by the simulator,
+ * which plays the role of the USB host, or by the Linux gadget (gadget/),
+ * which forwards them to a real USB device controller.
+ */
+
+#ifndef _SIM_LUFA_USB_H_
+#define _SIM_LUFA_USB_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/delay.h>
+
+#define ARCH_AVR8                0
+#define ARCH_UC3                 1
+#define ARCH_XMEGA               2
+#ifndef ARCH
+#define ARCH                     ARCH_AVR8
+#endif
+
+#if defined(USE_LUFA_CONFIG_HEADER)
+#include "LUFAConfig.h"
+#endif
+
+#define ATTR_PACKED              __attribute__ ((packed))
+#define ATTR_WARN_UNUSED_RESULT  __attribute__ ((warn_unused_result))
+#define ATTR_NON_NULL_PTR_ARG(...)
+
+// Device states
+enum USB_Device_States_t {
+	DEVICE_STATE_Unattached = 0,
+	DEVICE_STATE_Powered    = 1,
+	DEVICE_STATE_Default    = 2,
+	DEVICE_STATE_Addressed  = 3,
+	DEVICE_STATE_Configured = 4,
+	DEVICE_STATE_Suspended  = 5,
+};
+extern volatile uint8_t USB_DeviceState;
+
+// Endpoints
+#define ENDPOINT_DIR_OUT           0x00
+#define ENDPOINT_DIR_IN            0x80
+#define EP_TYPE_CONTROL            0x00
+#define EP_TYPE_ISOCHRONOUS        0x01
+#define EP_TYPE_BULK               0x02
+#define EP_TYPE_INTERRUPT          0x03
+#define ENDPOINT_ATTR_NO_SYNC      (0 << 2)
+#define ENDPOINT_USAGE_DATA        (0 << 4)
+
+enum Endpoint_Stream_RW_ErrorCodes_t {
+	ENDPOINT_RWSTREAM_NoError            = 0,
+	ENDPOINT_RWSTREAM_EndpointStalled    = 1,
+	ENDPOINT_RWSTREAM_DeviceDisconnected = 2,
+	ENDPOINT_RWSTREAM_BusSuspended       = 3,
+	ENDPOINT_RWSTREAM_Timeout            = 4,
+	ENDPOINT_RWSTREAM_IncompleteTransfer = 5,
+};
+
+bool    Endpoint_ConfigureEndpoint(const uint8_t Address, const uint8_t Type, const uint16_t Size, const uint8_t Banks);
+void    Endpoint_SelectEndpoint(const uint8_t Address);
+bool    Endpoint_IsOUTReceived(void);
+uint16_t Endpoint_BytesInEndpoint(void);
+bool    Endpoint_IsINReady(void);
+bool    Endpoint_IsReadWriteAllowed(void);
+void    Endpoint_ClearOUT(void);
+void    Endpoint_ClearIN(void);
+uint8_t Endpoint_Read_Stream_LE(void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed);
+uint8_t Endpoint_Write_Stream_LE(const void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed);
+
+void USB_Init(void);
+void USB_USBTask(void);
+
+// Control requests, as handed to EVENT_USB_Device_ControlRequest()
+typedef struct {
+	uint8_t  bmRequestType;
+	uint8_t  bRequest;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint16_t wLength;
+} ATTR_PACKED USB_Request_Header_t;
+extern USB_Request_Header_t USB_ControlRequest;
+
+#define REQDIR_HOSTTODEVICE        (0 << 7)
+#define REQDIR_DEVICETOHOST        (1 << 7)
+#define REQTYPE_STANDARD           (0 << 5)
+#define REQTYPE_CLASS              (1 << 5)
+#define REQTYPE_VENDOR             (2 << 5)
+#define REQREC_DEVICE              (0 << 0)
+#define REQREC_INTERFACE           (1 << 0)
+#define REQREC_ENDPOINT            (2 << 0)
+#define REQREC_OTHER               (3 << 0)
+
+void    Endpoint_ClearSETUP(void);
+void    Endpoint_ClearStatusStage(void);
+uint8_t Endpoint_Write_Control_Stream_LE(const void* const Buffer, uint16_t Length);
+uint8_t Endpoint_Write_Control_EStream_LE(const void* const Buffer, uint16_t Length);
+uint8_t Endpoint_Read_Control_Stream_LE(void* const Buffer, uint16_t Length);
+
+// Descriptors
+#define NO_DESCRIPTOR              0
+#define VERSION_BCD(Major, Minor, Revision) \
+	((((Major) & 0xFF) << 8) | (((Minor) & 0x0F) << 4) | ((Revision) & 0x0F))
+#define USB_CONFIG_POWER_MA(mA)    ((mA) >> 1)
+#define LANGUAGE_ID_ENG            0x0409
+
+enum USB_DescriptorTypes_t {
+	DTYPE_Device        = 0x01,
+	DTYPE_Configuration = 0x02,
+	DTYPE_String        = 0x03,
+	DTYPE_Interface     = 0x04,
+	DTYPE_Endpoint      = 0x05,
+};
+
+enum USB_Descriptor_ClassSubclassProtocol_t {
+	USB_CSCP_NoDeviceClass    = 0x00,
+	USB_CSCP_NoDeviceSubclass = 0x00,
+	USB_CSCP_NoDeviceProtocol = 0x00,
+	USB_CSCP_VendorSpecificClass = 0xFF,
+};
+
+enum HID_Descriptor_ClassSubclassProtocol_t {
+	HID_CSCP_HIDClass         = 0x03,
+	HID_CSCP_NonBootSubclass  = 0x00,
+	HID_CSCP_NonBootProtocol  = 0x00,
+};
+
+enum HID_DescriptorTypes_t {
+	HID_DTYPE_HID    = 0x21,
+	HID_DTYPE_Report = 0x22,
+};
+
+typedef struct {
+	uint8_t Size;
+	uint8_t Type;
+} ATTR_PACKED USB_Descriptor_Header_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint16_t USBSpecification;
+	uint8_t  Class;
+	uint8_t  SubClass;
+	uint8_t  Protocol;
+	uint8_t  Endpoint0Size;
+	uint16_t VendorID;
+	uint16_t ProductID;
+	uint16_t ReleaseNumber;
+	uint8_t  ManufacturerStrIndex;
+	uint8_t  ProductStrIndex;
+	uint8_t  SerialNumStrIndex;
+	uint8_t  NumberOfConfigurations;
+} ATTR_PACKED USB_Descriptor_Device_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint16_t TotalConfigurationSize;
+	uint8_t  TotalInterfaces;
+	uint8_t  ConfigurationNumber;
+	uint8_t  ConfigurationStrIndex;
+	uint8_t  ConfigAttributes;
+	uint8_t  MaxPowerConsumption;
+} ATTR_PACKED USB_Descriptor_Configuration_Header_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint8_t InterfaceNumber;
+	uint8_t AlternateSetting;
+	uint8_t TotalEndpoints;
+	uint8_t Class;
+	uint8_t SubClass;
+	uint8_t Protocol;
+	uint8_t InterfaceStrIndex;
+} ATTR_PACKED USB_Descriptor_Interface_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint16_t HIDSpec;
+	uint8_t  CountryCode;
+	uint8_t  TotalReportDescriptors;
+	uint8_t  HIDReportType;
+	uint16_t HIDReportLength;
+} ATTR_PACKED USB_HID_Descriptor_HID_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint8_t  EndpointAddress;
+	uint8_t  Attributes;
+	uint16_t EndpointSize;
+	uint8_t  PollingIntervalMS;
+} ATTR_PACKED USB_Descriptor_Endpoint_t;
+
+// String descriptors hold UTF-16 text, so wide strings need -fshort-wchar on the host.
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	wchar_t UnicodeString[];
+} ATTR_PACKED USB_Descriptor_String_t;
+
+#define USB_STRING_LEN(UnicodeChars) (sizeof(USB_Descriptor_Header_t) + ((UnicodeChars) << 1))
+#define USB_STRING_DESCRIPTOR(String) \
+	{ .Header = {.Size = sizeof(USB_Descriptor_Header_t) + (sizeof(String) - 2), .Type = DTYPE_String}, .UnicodeString = String }
+#define USB_STRING_DESCRIPTOR_ARRAY(...) \
+	{ .Header = {.Size = sizeof(USB_Descriptor_Header_t) + sizeof((uint16_t[]){__VA_ARGS__}), .Type = DTYPE_String}, .UnicodeString = {__VA_ARGS__} }
+
+// HID report descriptor items
+typedef uint8_t USB_Descriptor_HIDReport_Datatype_t;
+
+#define HID_RI_DATA_BITS_0         0x00
+#define HID_RI_DATA_BITS_8         0x01
+#define HID_RI_DATA_BITS_16        0x02
+#define HID_RI_DATA_BITS_32        0x03
+#define HID_RI_TYPE_MAIN           0x00
+#define HID_RI_TYPE_GLOBAL         0x04
+#define HID_RI_TYPE_LOCAL          0x08
+
+#define _HID_RI_ENCODE_0(Data)
+#define _HID_RI_ENCODE_8(Data)     , ((Data) & 0xFF)
+#define _HID_RI_ENCODE_16(Data)    _HID_RI_ENCODE_8(Data) _HID_RI_ENCODE_8((Data) >> 8)
+#define _HID_RI_ENCODE_32(Data)    _HID_RI_ENCODE_16(Data) _HID_RI_ENCODE_16((Data) >> 16)
+#define _HID_RI_ENCODE(DataBits, ...) _HID_RI_ENCODE_ ## DataBits(__VA_ARGS__)
+#define _HID_RI_ENTRY(Type, Tag, DataBits, ...) \
+	(Type | Tag | HID_RI_DATA_BITS_ ## DataBits) _HID_RI_ENCODE(DataBits, (__VA_ARGS__))
+
+#define HID_RI_INPUT(DataBits, ...)            _HID_RI_ENTRY(HID_RI_TYPE_MAIN  , 0x80, DataBits, __VA_ARGS__)
+#define HID_RI_OUTPUT(DataBits, ...)           _HID_RI_ENTRY(HID_RI_TYPE_MAIN  , 0x90, DataBits, __VA_ARGS__)
+#define HID_RI_COLLECTION(DataBits, ...)       _HID_RI_ENTRY(HID_RI_TYPE_MAIN  , 0xA0, DataBits, __VA_ARGS__)
+#define HID_RI_FEATURE(DataBits, ...)          _HID_RI_ENTRY(HID_RI_TYPE_MAIN  , 0xB0, DataBits, __VA_ARGS__)
+#define HID_RI_END_COLLECTION(DataBits, ...)   _HID_RI_ENTRY(HID_RI_TYPE_MAIN  , 0xC0, DataBits, __VA_ARGS__)
+#define HID_RI_USAGE_PAGE(DataBits, ...)       _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x00, DataBits, __VA_ARGS__)
+#define HID_RI_LOGICAL_MINIMUM(DataBits, ...)  _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x10, DataBits, __VA_ARGS__)
+#define HID_RI_LOGICAL_MAXIMUM(DataBits, ...)  _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x20, DataBits, __VA_ARGS__)
+#define HID_RI_PHYSICAL_MINIMUM(DataBits, ...) _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x30, DataBits, __VA_ARGS__)
+#define HID_RI_PHYSICAL_MAXIMUM(DataBits, ...) _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x40, DataBits, __VA_ARGS__)
+#define HID_RI_UNIT_EXPONENT(DataBits, ...)    _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x50, DataBits, __VA_ARGS__)
+#define HID_RI_UNIT(DataBits, ...)             _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x60, DataBits, __VA_ARGS__)
+#define HID_RI_REPORT_SIZE(DataBits, ...)      _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x70, DataBits, __VA_ARGS__)
+#define HID_RI_REPORT_ID(DataBits, ...)        _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x80, DataBits, __VA_ARGS__)
+#define HID_RI_REPORT_COUNT(DataBits, ...)     _HID_RI_ENTRY(HID_RI_TYPE_GLOBAL, 0x90, DataBits, __VA_ARGS__)
+#define HID_RI_USAGE(DataBits, ...)            _HID_RI_ENTRY(HID_RI_TYPE_LOCAL , 0x00, DataBits, __VA_ARGS__)
+#define HID_RI_USAGE_MINIMUM(DataBits, ...)    _HID_RI_ENTRY(HID_RI_TYPE_LOCAL , 0x10, DataBits, __VA_ARGS__)
+#define HID_RI_USAGE_MAXIMUM(DataBits, ...)    _HID_RI_ENTRY(HID_RI_TYPE_LOCAL , 0x20, DataBits, __VA_ARGS__)
+
+#endif
@@ -0,0 +1,9 @@
+/* Host stand-in for <LUFA/Platform/Platform.h>. */
+
+#ifndef _SIM_LUFA_PLATFORM_H_
+#define _SIM_LUFA_PLATFORM_H_
+
+#define GlobalInterruptEnable()  ((void)0)
+#define GlobalInterruptDisable() ((void)0)
+
+#endif
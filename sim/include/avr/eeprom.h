@@ -0,0 +1,17 @@
+/* Host stand-in for <avr/eeprom.h>: the EEPROM is ordinary memory on the host. */
+
+#ifndef _SIM_AVR_EEPROM_H_
+#define _SIM_AVR_EEPROM_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define EEMEM
+
+#define eeprom_is_ready() 1
+#define eeprom_read_byte(addr) (*(const uint8_t*)(addr))
+#define eeprom_update_byte(addr, value) (*(uint8_t*)(addr) = (value))
+#define eeprom_read_block(dest, src, n) memcpy((dest), (src), (n))
+#define eeprom_update_block(src, dest, n) memcpy((dest), (src), (n))
+
+#endif
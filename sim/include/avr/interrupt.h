@@ -0,0 +1,12 @@
+/* Host stand-in for <avr/interrupt.h>. */
+
+#ifndef _SIM_AVR_INTERRUPT_H_
+#define _SIM_AVR_INTERRUPT_H_
+
+#define sei() ((void)0)
+#define cli() ((void)0)
+
+// An interrupt handler is a plain function, called by the simulator when the interrupt would fire.
+#define ISR(vector, ...) void vector(void)
+
+#endif
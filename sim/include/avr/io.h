@@ -0,0 +1,32 @@
+/* Host stand-in for <avr/io.h>: the I/O registers used by the firmware are plain variables. */
+
+#ifndef _SIM_AVR_IO_H_
+#define _SIM_AVR_IO_H_
+
+#include <stdint.h>
+
+extern volatile uint8_t PORTB, PORTD, DDRB, DDRD;
+extern volatile uint8_t MCUSR;
+extern volatile uint8_t TCCR0A, TCCR0B, OCR0A, TIMSK0;
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+// Memory of the at90usb1286 the makefile builds for, so the size guards hold here too.
+#define RAMSTART 0x0100
+#define RAMEND   0x20FF
+#define E2END    0x0FFF
+
+#define PORF  0
+#define EXTRF 1
+#define BORF  2
+#define WDRF  3
+
+#define WGM01  1
+#define CS00   0
+#define CS01   1
+#define CS02   2
+#define OCIE0A 1
+
+#endif
@@ -0,0 +1,16 @@
+/* Host stand-in for <avr/pgmspace.h>: flash and RAM share one address space on the host. */
+
+#ifndef _SIM_AVR_PGMSPACE_H_
+#define _SIM_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+
+#endif
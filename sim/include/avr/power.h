@@ -0,0 +1,9 @@
+/* Host stand-in for <avr/power.h>. */
+
+#ifndef _SIM_AVR_POWER_H_
+#define _SIM_AVR_POWER_H_
+
+#define clock_div_1 0
+#define clock_prescale_set(div) ((void)(div))
+
+#endif
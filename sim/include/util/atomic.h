@@ -0,0 +1,10 @@
+/* Host stand-in for <util/atomic.h>: the simulator has no interrupts to hold off. */
+
+#ifndef _SIM_UTIL_ATOMIC_H_
+#define _SIM_UTIL_ATOMIC_H_
+
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_FORCEON      0
+#define ATOMIC_BLOCK(type) for (int _atomic_once = 1; _atomic_once; _atomic_once = 0)
+
+#endif
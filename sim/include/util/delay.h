@@ -0,0 +1,10 @@
+/* Host stand-in for <util/delay.h>: busy waits are accounted by the simulator instead. */
+
+#ifndef _SIM_UTIL_DELAY_H_
+#define _SIM_UTIL_DELAY_H_
+
+void SimDelay(double ms);
+
+#define _delay_ms(ms) SimDelay(ms)
+
+#endif
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""Estimate how robust the route's waits are against load-time and poll jitter.
+
+The waits are read from route.txt (through route2c.py's parser) and the
+game latency each of them covers from latency.json. Every simulated cycle
+draws one latency per event and a host poll period, and a wait succeeds when
+it lasts longer than its event. Cycles are spread over all cores.
+
+For every wait the report gives the success probability, the frames needed
+to reach the target reliability and how many frames could be cut; steps and
+the whole cycle are summarised the same way.
+"""
+
+import argparse, json, math, os, random, sys
+from collections import Counter
+from multiprocessing import Pool
+
+SIM_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(SIM_DIR)
+sys.path.insert(0, ROOT)
+import route2c
+
+CHUNK = 20000                             # cycles per worker task
+
+class Wait(object):
+  def __init__(self, event, frames, echo, line):
+    self.event, self.frames, self.line = event, frames, line
+    self.name, self.phase = event["name"], event["phase"]
+    self.polls_per_frame = 1 + echo         # Joystick.c: every frame is sent 1 + echo times
+
+def load_waits(route_path, model, soft_type, values):
+  """Find the NOTHING command each event is covered by, with its length in frames.
+
+  The route's conditionals are decided with values, the controller's Config.h."""
+  buttons = route2c.read_buttons(os.path.join(ROOT, "Step.h"))
+  config = route2c.read_config(os.path.join(ROOT, "Config.h"))
+  parsed = route2c.Parser(route2c.tokenize(open(route_path).read()), buttons, config).phases()
+  phases = dict((phase.name, phase) for phase in parsed)
+
+  waits = []
+  for event in model["events"]:
+    phase = phases.get(event["phase"])
+    if phase is None:
+      raise route2c.RouteError("{}: no phase {} in {}".format(event["name"], event["phase"], route_path))
+    if "track" in event:
+      body = (phase.tracks or {}).get(event["track"])
+    else:
+      body = phase.body
+    if body is None:
+      raise route2c.RouteError("{}: phase {} has no such track".format(event["name"], phase.name))
+    items = route2c.decide(route2c.expand(body, phases, [phase.name]), values)
+    index = event["command"]
+    if index >= len(items) or not isinstance(items[index], route2c.Cmd) or items[index].button != "NOTHING":
+      raise route2c.RouteError("{}: command {} of {} is not an unconditional NOTHING".format(event["name"], index, phase.name))
+
+    # A command with duration d lasts d + 1 frames; with SOFT_TYPE the END of
+    # GoToAlterna and EnterStage holds the wait for phase.end more frames.
+    frames = items[index].duration + 1
+    if soft_type and index == len(items) - 1 and "track" not in event:
+      frames += phase.end
+    # The last frames of a wait with an accepts window may already play the
+    # next step's input. Only with EARLY_HOLD_CREDIT do they shorten its hold,
+    # so only then is just the rest of the wait counted on. A cartridge build
+    # plays no input early (Joystick.c: PackEarly).
+    if items[index].accepts and values.get("EARLY_HOLD_CREDIT") and not soft_type:
+      frames -= items[index].accepts[0]
+    waits.append(Wait(event, frames, route2c.echo_value(phase.echo, values), items[index].line))
+  return waits
+
+def draw(rng, event, soft_type):
+  dist = event["dist"]
+  if dist == "lognormal":
+    latency = rng.lognormvariate(math.log(event["median"]), event["sigma"])
+  elif dist == "normal":
+    latency = max(0.0, rng.gauss(event["mean"], event["sd"]))
+  elif dist == "uniform":
+    latency = rng.uniform(event["min"], event["max"])
+  else:
+    latency = event["value"]
+  if soft_type:
+    latency *= event.get("soft_type_factor", 1.0)
+  if "hiccup" in event and rng.random() < event["hiccup"][0]:
+    latency += event["hiccup"][1]
+  return latency
+
+def simulate(task):
+  """Run a chunk of cycles; return the histogram of frames each wait needed and the failures."""
+  seed, cycles, waits, model, soft_type = task
+  rng = random.Random(seed)
+  needed = [Counter() for _ in waits]
+  failed = [0] * len(waits)
+  steps_failed = Counter()
+  cycles_failed = 0
+
+  for _ in range(cycles):
+    # The host's poll period drifts from unit to unit; single polls jitter around it.
+    poll = rng.gauss(model["poll_ms"], model["poll_drift_ms"]) / 1000.0
+    failed_steps = set()
+    for i, wait in enumerate(waits):
+      latency = draw(rng, wait.event, soft_type)
+      jitter = rng.gauss(0.0, model["poll_jitter_ms"] / 1000.0 * math.sqrt(wait.frames * wait.polls_per_frame))
+      frames = max(0, int(math.ceil((latency + jitter) / (poll * wait.polls_per_frame))))
+      needed[i][frames] += 1
+      if frames > wait.frames:
+        failed[i] += 1
+        failed_steps.add(wait.phase)
+    for phase in failed_steps:
+      steps_failed[phase] += 1
+    cycles_failed += bool(failed_steps)
+
+  return needed, failed, steps_failed, cycles_failed
+
+def quantile(histogram, total, target):
+  """Smallest wait in frames that covers the event in at least target of the cycles."""
+  covered = 0
+  for frames in sorted(histogram):
+    covered += histogram[frames]
+    if covered >= target * total:
+      return frames
+  return max(histogram)
+
+def main(argv):
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("-n", "--cycles", type=int, default=1000000, help="cycles to simulate (default 1000000)")
+  parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(), help="parallel workers (default: all cores)")
+  parser.add_argument("-t", "--target", type=float, default=0.9999, help="reliability every wait must reach (default 0.9999)")
+  parser.add_argument("-m", "--model", default=os.path.join(SIM_DIR, "latency.json"), help="latency model (default latency.json)")
+  parser.add_argument("-r", "--route", default=os.path.join(ROOT, "route.txt"), help="route file (default ../route.txt)")
+  parser.add_argument("-s", "--seed", type=int, default=1, help="random seed (default 1)")
+  parser.add_argument("--soft-type", action="store_true", help="model a cartridge (SOFT_TYPE 1)")
+  parser.add_argument("-D", dest="defines", action="append", default=[], metavar="NAME=VALUE",
+                      help="a Config.h value the controller is built with (e.g. -D FAST_MENUS=1)")
+  parser.add_argument("--json", help="write the full results to this file")
+  args = parser.parse_args(argv)
+
+  model = json.load(open(args.model))
+  values = route2c.read_values(os.path.join(ROOT, "Config.h"))
+  for define in args.defines:
+    name, _, value = define.partition("=")
+    values[name] = int(value or "1", 0)
+  if args.soft_type:
+    values["SOFT_TYPE"] = 1
+  try:
+    waits = load_waits(args.route, model, args.soft_type, values)
+  except route2c.RouteError as e:
+    print("robust: {}".format(e))
+    return 2
+
+  tasks = []
+  for start in range(0, args.cycles, CHUNK):
+    tasks.append((args.seed * 1000003 + start, min(CHUNK, args.cycles - start), waits, model, args.soft_type))
+  with Pool(args.jobs) as pool:
+    results = pool.map(simulate, tasks)
+
+  needed = [Counter() for _ in waits]
+  failed = [0] * len(waits)
+  steps_failed = Counter()
+  cycles_failed = 0
+  for chunk_needed, chunk_failed, chunk_steps, chunk_cycles in results:
+    for i in range(len(waits)):
+      needed[i].update(chunk_needed[i])
+      failed[i] += chunk_failed[i]
+    steps_failed.update(chunk_steps)
+    cycles_failed += chunk_cycles
+
+  total = args.cycles
+  rows = []
+  print("{:<22} {:<16} {:>6} {:>7} {:>10} {:>7} {:>5}".format("event", "phase", "line", "frames", "success", "needed", "cut"))
+  for i, wait in enumerate(waits):
+    frames = quantile(needed[i], total, args.target)
+    success = 1.0 - failed[i] / total
+    row = {"event": wait.name, "phase": wait.phase, "line": wait.line, "frames": wait.frames,
+           "success": success, "needed": frames, "cut": wait.frames - frames}
+    rows.append(row)
+    print("{:<22} {:<16} {:>6} {:>7} {:>10.6f} {:>7} {:>5}".format(
+      wait.name[:22], wait.phase[:16], "{}".format(wait.line), wait.frames, success, frames, row["cut"]))
+
+  print()
+  steps = {}
+  for phase in sorted(set(wait.phase for wait in waits), key=[w.phase for w in waits].index):
+    steps[phase] = 1.0 - steps_failed[phase] / total
+    print("step {:<28} success {:.6f}".format(phase, steps[phase]))
+  cycle = 1.0 - cycles_failed / total
+  cut = sum(max(0, row["cut"]) for row in rows)
+  cut_ms = sum(max(0, row["cut"]) * model["poll_ms"] * wait.polls_per_frame for row, wait in zip(rows, waits))
+  print("cycle success {:.6f} over {} cycles; {} frames ({:.1f} s) could be cut at {} per wait".format(
+    cycle, total, cut, cut_ms / 1000.0, args.target))
+
+  if args.json:
+    with open(args.json, "w") as f:
+      json.dump({"cycles": total, "target": args.target, "soft_type": args.soft_type,
+                 "waits": rows, "steps": steps, "cycle_success": cycle}, f, indent=1)
+  return 0
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Prove and time every combination of the Config.h switches.
+
+Each combination is compiled into its own simulator binary (see makefile)
+and run with the console model (-m); builds and runs are spread over all
+cores. The report lists the cycle length of every profile and any invariant
+violation found by Sim.c, including steps that land on the wrong menu item.
+
+START_AT_KETTLE seeks with the route's index, so those profiles link the
+index emitted (-i) by the profile with the same switches that starts from
+the beginning; the two are built one after the other.
+"""
+
+import argparse, itertools, json, os, subprocess, sys, tempfile
+from concurrent.futures import ThreadPoolExecutor
+
+SIM_DIR = os.path.dirname(os.path.abspath(__file__))
+
+SWITCHES = [
+  ("INFINITE_LOOP_MODE", (0, 1)),
+  ("DRONE_CLEARS",       (1, 4)),
+  ("DRONE_RUNS",         (1, 2)),
+  ("GYRO_SETTING",       (0, 1)),
+  ("SENSITIVITY",        tuple(range(-5, 6))),
+  ("REVERSE_LR",         (0, 1)),
+  ("REVERSE_UD",         (0, 1)),
+  ("SOFT_TYPE",          (0, 1)),
+  ("PRO_CONTROLLER",     (0, 1)),
+  ("FAST_MENUS",         (0, 1)),
+  ("EARLY_HOLD_CREDIT",  (0, 1)),
+  ("START_AT_KETTLE",    (0, 1)),                 # last: see run_group()
+]
+
+def run(combo, workdir, poll_ms, index=None):
+  config = " ".join("-D{}={}".format(name, value) for (name, _), value in zip(SWITCHES, combo))
+  binary = os.path.join(workdir, "sim_" + "_".join(str(v) for v in combo))
+  make = ["make", "-s", "-C", SIM_DIR, "BIN=" + binary, "CONFIG=" + config]
+  build = subprocess.run(make + (["INDEX=" + index] if index else []),
+                         stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+  if build.returncode != 0:
+    return {"config": dict(zip((n for n, _ in SWITCHES), combo)), "violations": ["build failed: " + build.stdout.strip()]}, None
+  result = subprocess.run([binary, "-m", "-p", str(poll_ms)], stdout=subprocess.PIPE, universal_newlines=True)
+  return json.loads(result.stdout), binary
+
+def run_group(group, workdir, poll_ms):
+  """The profiles that differ only in START_AT_KETTLE: the one from the
+  beginning first, which then emits the index the other seeks with."""
+  results, index = [], None
+  for combo in group:
+    result, binary = run(combo, workdir, poll_ms, index if combo[-1] else None)
+    results.append(result)
+    if not combo[-1] and binary:
+      index = binary + "_index.c"
+      with open(index, "w") as f:
+        subprocess.run([binary, "-i"], stdout=f, check=True)
+  return results
+
+def main(argv):
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(), help="parallel builds/runs (default: all cores)")
+  parser.add_argument("-p", "--poll-ms", type=float, default=8.0, help="host poll period in ms (default 8)")
+  parser.add_argument("--phases", action="store_true", help="also print the polls spent in every step")
+  parser.add_argument("--json", help="write the full results to this file")
+  args = parser.parse_args(argv)
+
+  groups = [[rest + (value,) for value in SWITCHES[-1][1]]
+            for rest in itertools.product(*(values for _, values in SWITCHES[:-1]))]
+  with tempfile.TemporaryDirectory() as workdir:
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+      results = [result for group in pool.map(lambda group: run_group(group, workdir, args.poll_ms), groups)
+                 for result in group]
+
+  names = [name for name, _ in SWITCHES]
+  print(" ".join("{:>4}".format(name[:4]) for name in names) + "     polls  cycle[s]  result")
+  failed = 0
+  for result in results:
+    row = " ".join("{:>4}".format(result["config"][name]) for name in names)
+    if result["violations"]:
+      failed += 1
+      print(row + "         -         -  FAIL: " + "; ".join(result["violations"]))
+      continue
+    print(row + " {:>9} {:>9.1f}  ok".format(result["cycle_polls"], result["cycle_seconds"]))
+    if args.phases:
+      for phase, polls in result["phases"].items():
+        if polls:
+          print("      {:<20} {:>8} polls".format(phase, polls))
+
+  print("{} profiles, {} failed".format(len(results), failed))
+  if args.json:
+    with open(args.json, "w") as f:
+      json.dump(results, f, indent=1)
+  return 1 if failed else 0
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))
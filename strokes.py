@@ -0,0 +1,545 @@
+#!/usr/bin/env python3
+
+"""Plan the strokes that print a 320x120 bitmap with the post tool's brushes.
+
+Drawing one pixel per press visits every pixel of the canvas. Instead, the
+bitmap is split into the regions each brush can fill without painting
+outside the image (the bitmap eroded by the brush), and these are covered
+with horizontal strokes: A is held while the cursor moves, so a stroke costs
+two frames per pixel of travel whatever the brush size. The large brushes
+fill the interiors; the 1-pixel brush only draws what is left at the edges.
+
+Brush switches, travel between strokes and the strokes themselves are
+costed in frames by the same rules that expand the plan into reports, and
+a large brush is only used when the frames it saves pay for switching to
+it. The post tool's timings and brushes are the guesses listed at the top
+of this file, so the frame counts are those of the model.
+
+Painting a dark pixel twice does no harm, so the 1-pixel brush strokes
+through pixels that are already drawn, and draws the left and right edges
+of filled regions with vertical strokes.
+
+Between strokes, a HAT tap moves the cursor one pixel in two frames. The
+left stick held at an extreme (the reports only use STICK_MIN and STICK_MAX)
+moves it faster the longer it is held, by the travel in STICK_TRAVEL, which
+the --calibrate print measures and --stick reads back. The cursor keeps the fraction of a pixel the stick leaves it at,
+and the real travel is only known to STICK_TOLERANCE, so every jump adds to
+how far the cursor may be from where the plan expects it. A jump is only
+made when the cursor still lands on the right pixel however far off it is;
+taps finish the move. Once the error has grown too large for the jumps that
+pay, the stick first pushes the cursor into the top left corner, which puts
+it back on a known pixel, and the next jump starts from there.
+
+The plan is a list of operations, written one per line with -o:
+  brush <from> <to>     switch brush (indices into the brush sizes)
+  move <dx> <dy>        move the cursor without drawing (HAT taps, diagonals allowed)
+  stroke <dx> <dy>      hold A and move the cursor in a straight line (0 0 is a dot)
+  jump <nx> <ny>        hold the left stick for |nx| frames right (left when
+                        negative) and |ny| frames down (up), together, then release
+  home <n>              hold the left stick to the top left for n frames, then release
+"""
+
+import sys, re, math, bisect, argparse
+import img2c
+
+WIDTH, HEIGHT = 320, 120
+FULL = (1 << WIDTH) - 1
+
+# The post tool as the planner models it. These are guesses that have not
+# been measured on the console; canvas.py uses the same values.
+BRUSHES = [1, 3, 7]                       # brush sizes in pixels, smallest first
+BRUSH_UP, BRUSH_DOWN = "R", "L"           # one tap changes the size by one step
+BRUSH_SETTLE = 4                          # frames before the new brush draws
+START_BRUSH = 0                           # the post tool opens with the smallest brush
+HAT_DELAY = 30                            # frames a HAT direction is held before it repeats
+HAT_REPEAT = 2                            # frames between repeats
+STICK_SPEED = 2.4                         # pixels per frame with the left stick at an extreme
+STICK_RAMP = 4                            # frames the cursor takes to reach that speed
+STICK_TOLERANCE = 0.002                   # how far the real travel may be off, per pixel travelled
+HOME_OVERDRIVE = 2                        # frames a re-home keeps pushing into the corner
+
+# Frames per action. A tap is one frame pressed and one released.
+TAP = 2
+
+STICK_MIN, STICK_CENTER, STICK_MAX = 0, 128, 255  # Joystick.h
+CALIBRATE = [1, 2, 3, 4, 5, 6, 8, 10, 15, 20, 30, 40, 60, 80, 100, 120] # holds the --calibrate print measures
+
+NEAREST_LIMIT = 1500                      # passes with more strokes are ordered row by row
+
+class ImageError(Exception):
+  pass
+
+# ---------------------------------------------------------------- input
+
+def unpack(data, invert=False):
+  """Rows of pixel bits (bit x set = draw pixel x) from image_data bytes."""
+  rows = []
+  for y in range(HEIGHT):
+    row = int.from_bytes(bytes(data[y * WIDTH // 8:(y + 1) * WIDTH // 8]), "little")
+    rows.append(row ^ FULL if invert else row)
+  return rows
+
+def read_image(path, invert=False):
+  """Read image.c (as written by img2c.py -f raw), a .data file or a 320x120 PNG."""
+  if path.endswith(".c"):
+    match = re.search(r"image_data\s*\[[^]]*\]\s*PROGMEM\s*=\s*\{([^}]*)\}", open(path).read())
+    if not match:
+      raise ImageError("cannot find image_data in " + path)
+    data = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", match.group(1))]
+    if len(data) < WIDTH * HEIGHT // 8:
+      raise ImageError("{}: {} bytes, expected {}".format(path, len(data), WIDTH * HEIGHT // 8))
+  else:
+    try:
+      data = img2c.pack(img2c.read_pixels(path))
+    except img2c.ImageError as e:
+      raise ImageError("{}: {}".format(path, e))
+  return unpack(data, invert)
+
+def stick_model(speed=STICK_SPEED, ramp=STICK_RAMP):
+  """Pixels the cursor travels while the stick is held for 0, 1, 2, ... frames:
+  speed * i / ramp on the i-th frame until it reaches speed. The table runs
+  until it crosses the canvas."""
+  travel = [0.0]
+  while travel[-1] < WIDTH + speed * ramp:
+    travel.append(travel[-1] + speed * min(1.0, len(travel) / float(ramp)))
+  return travel
+
+def read_stick(path):
+  """A measured travel table: lines of <frames> <pixels>, e.g. read off the
+  --calibrate print. Frames in between are interpolated, and the speed of
+  the last two carries on beyond them."""
+  points = [(0, 0.0)]
+  for line in open(path):
+    fields = line.split("#")[0].split()
+    if fields:
+      points.append((int(fields[0]), float(fields[1])))
+  points.sort()
+  if len(points) < 3 or any(b[0] == a[0] or b[1] <= a[1] for a, b in zip(points, points[1:])):
+    raise ValueError("{}: expected two or more <frames> <pixels> lines, both increasing".format(path))
+  travel = [0.0]
+  for (n0, d0), (n1, d1) in zip(points, points[1:]):
+    for n in range(n0 + 1, n1 + 1):
+      travel.append(d0 + (d1 - d0) * (n - n0) / float(n1 - n0))
+  speed = travel[-1] - travel[-2]
+  while travel[-1] < WIDTH + speed:
+    travel.append(travel[-1] + speed)
+  return travel
+
+STICK_TRAVEL = stick_model()
+
+# ---------------------------------------------------------------- regions
+
+def popcount(x):
+  return bin(x).count("1")
+
+def runs(bits):
+  """(first, last) column of every run of set bits."""
+  out = []
+  x = 0
+  while bits:
+    skip = (bits & -bits).bit_length() - 1
+    bits >>= skip
+    x += skip
+    length = (~bits & (bits + 1)).bit_length() - 1
+    out.append((x, x + length - 1))
+    bits >>= length
+    x += length
+  return out
+
+def centers(rows, size):
+  """Rows of the cursor positions where a brush of this size paints only image pixels.
+
+  The brush is a size x size square centred on the cursor and clipped by the
+  edges of the canvas, so it may hang over an edge."""
+  r = size // 2
+  eroded = []
+  for row in rows:
+    h = row
+    for d in range(1, r + 1):
+      h &= (row >> d) | (FULL ^ (FULL >> d))
+      h &= ((row << d) & FULL) | ((1 << d) - 1)
+    eroded.append(h)
+  out = []
+  for y in range(HEIGHT):
+    c = FULL
+    for yy in range(max(0, y - r), min(HEIGHT, y + r + 1)):
+      c &= eroded[yy]
+    out.append(c)
+  return out
+
+def span(first, last):
+  return ((1 << (last - first + 1)) - 1) << first
+
+def transpose(rows):
+  cols = [0] * WIDTH
+  for y, row in enumerate(rows):
+    for first, last in runs(row):
+      for x in range(first, last + 1):
+        cols[x] |= 1 << y
+  return cols
+
+def serpentine(strokes):
+  """Order (x0, y0, x1, y1) strokes row by row, alternating the direction on
+  every row that has strokes."""
+  ordered = []
+  rows = sorted(set(s[1] for s in strokes))
+  for i, y in enumerate(rows):
+    row = sorted(s for s in strokes if s[1] == y)
+    if i % 2 == 0:
+      ordered.extend(row)
+    else:
+      ordered.extend((x1, y1, x0, y0) for x0, y0, x1, y1 in reversed(row))
+  return ordered
+
+def nearest(strokes, x, y):
+  """Order strokes by always drawing the one with the closest end next."""
+  todo = list(strokes)
+  ordered = []
+  while todo:
+    best, best_i, flip = None, 0, False
+    for i, (x0, y0, x1, y1) in enumerate(todo):
+      d0 = max(abs(x0 - x), abs(y0 - y))
+      d1 = max(abs(x1 - x), abs(y1 - y))
+      if best is None or min(d0, d1) < best:
+        best, best_i, flip = min(d0, d1), i, d1 < d0
+        if best == 0:
+          break
+    x0, y0, x1, y1 = todo.pop(best_i)
+    if flip:
+      x0, y0, x1, y1 = x1, y1, x0, y0
+    ordered.append((x0, y0, x1, y1))
+    x, y = x1, y1
+  return ordered
+
+def cover(left, valid, size):
+  """Strokes of a large brush over the pixels still to draw.
+
+  Scans down the valid cursor rows. A run of positions is stroked when the
+  top row under the brush still has pixels to draw, or when it is the last
+  row the brush fits in, so strokes land one brush height apart. A stroke is
+  kept only when drawing its new pixels with the 1-pixel brush would take
+  longer than the stroke itself. Returns the strokes and updates left."""
+  r = size // 2
+  strokes = []
+  for y in range(HEIGHT):
+    top, bottom = max(0, y - r), min(HEIGHT - 1, y + r)
+    for first, last in runs(valid[y]):
+      mask = span(max(0, first - r), min(WIDTH - 1, last + r))
+      last_chance = y + 1 == HEIGHT or not (valid[y + 1] & span(first, last))
+      if not (left[top] & mask) and not last_chance:
+        continue
+      gain = sum(popcount(left[yy] & mask) for yy in range(top, bottom + 1))
+      # The same pixels with the 1-pixel brush: a tap per pixel along the rows.
+      if gain * TAP <= stroke_frames(last - first) + TAP:
+        continue
+      strokes.append((first, y, last, y))
+      for yy in range(top, bottom + 1):
+        left[yy] &= ~mask
+  return strokes
+
+def fine_strokes(rows, left, upright):
+  """Strokes of the 1-pixel brush over the pixels still to draw.
+
+  With upright, a pixel is drawn vertically when more pixels to draw are
+  stacked on it than lie beside it, e.g. along the sides of a filled region.
+  Each stroke runs from the first to the last pixel to draw within a run of
+  dark pixels."""
+  across = [0] * HEIGHT
+  for y, row in enumerate(left):
+    for first, last in runs(row):
+      for x in range(first, last + 1):
+        across[y] |= (last - first + 1) << (x * 9)
+  vertical = [0] * HEIGHT
+  for x, col in enumerate(transpose(left) if upright else []):
+    for first, last in runs(col):
+      for y in range(first, last + 1):
+        if last - first + 1 > (across[y] >> (x * 9)) & 0x1FF:
+          vertical[y] |= 1 << x
+
+  strokes = []
+  for y, row in enumerate(rows):
+    for first, last in runs(row):
+      todo = left[y] & ~vertical[y] & span(first, last)
+      if todo:
+        strokes.append(((todo & -todo).bit_length() - 1, y, todo.bit_length() - 1, y))
+  vertical = transpose(vertical)
+  for x, col in enumerate(transpose(rows)):
+    for first, last in runs(col):
+      todo = vertical[x] & span(first, last)
+      if todo:
+        strokes.append((x, (todo & -todo).bit_length() - 1, x, todo.bit_length() - 1))
+  return strokes
+
+# ---------------------------------------------------------------- cost model
+
+def move_frames(dx, dy):
+  return TAP * max(abs(dx), abs(dy))
+
+def stroke_frames(dx, dy=0):
+  # A pressed, a tap per pixel with A held, A released.
+  return 1 + TAP * max(abs(dx), abs(dy)) + 1
+
+def switch_frames(source, target):
+  return (TAP * abs(target - source) + BRUSH_SETTLE) if source != target else 0
+
+def jump_frames(nx, ny):
+  # The stick held for the longer of the two axes, then one frame released.
+  n = max(abs(nx), abs(ny))
+  return n + 1 if n else 0
+
+def cost(ops):
+  frames = 0
+  for op in ops:
+    if op[0] == "brush":
+      frames += switch_frames(op[1], op[2])
+    elif op[0] == "move":
+      frames += move_frames(op[1], op[2])
+    elif op[0] == "jump":
+      frames += jump_frames(op[1], op[2])
+    elif op[0] == "home":
+      frames += jump_frames(op[1], op[1])
+    else:
+      frames += stroke_frames(op[1], op[2])
+  return frames
+
+CENTERED = (STICK_CENTER, STICK_CENTER)
+
+def stick(frames, i):
+  """The stick along one axis on the i-th frame of a jump held for frames."""
+  if i >= abs(frames):
+    return STICK_CENTER
+  return STICK_MAX if frames > 0 else STICK_MIN
+
+def reports(ops):
+  """Expand a plan into frames of (buttons, hat, (lx, ly)); the frame count equals cost(ops)."""
+  for op in ops:
+    if op[0] == "brush":
+      if op[1] == op[2]:
+        continue
+      button = BRUSH_UP if op[2] > op[1] else BRUSH_DOWN
+      for _ in range(abs(op[2] - op[1])):
+        yield ((button,), "CENTER", CENTERED)
+        yield ((), "CENTER", CENTERED)
+      for _ in range(BRUSH_SETTLE):
+        yield ((), "CENTER", CENTERED)
+    elif op[0] == "move":
+      for hat in taps(op[1], op[2]):
+        yield ((), hat, CENTERED)
+        yield ((), "CENTER", CENTERED)
+    elif op[0] in ("jump", "home"):
+      nx, ny = (op[1], op[2]) if op[0] == "jump" else (-op[1], -op[1])
+      if nx or ny:
+        for i in range(max(abs(nx), abs(ny))):
+          yield ((), "CENTER", (stick(nx, i), stick(ny, i)))
+        yield ((), "CENTER", CENTERED)
+    else:
+      yield (("A",), "CENTER", CENTERED)
+      for hat in taps(op[1], op[2]):
+        yield (("A",), hat, CENTERED)
+        yield (("A",), "CENTER", CENTERED)
+      yield ((), "CENTER", CENTERED)
+
+def taps(dx, dy):
+  """HAT directions that move the cursor by (dx, dy), diagonals first."""
+  while dx or dy:
+    yield ("TOP" if dy < 0 else "BOTTOM" if dy > 0 else "") + ("_" if dx and dy else "") + \
+          ("LEFT" if dx < 0 else "RIGHT" if dx > 0 else "")
+    dx -= (dx > 0) - (dx < 0)
+    dy -= (dy > 0) - (dy < 0)
+
+# ---------------------------------------------------------------- travel
+
+class Cursor(object):
+  """Where the plan expects the cursor, with the fraction of a pixel the
+  stick leaves, and how far off the game may be on each axis."""
+  def __init__(self):
+    self.x, self.y = 0.0, 0.0             # homed at the top left
+    self.ux, self.uy = 0.0, 0.0
+
+def nearest_pixel(v):
+  return int(math.floor(v + 0.5))
+
+def clamp(v, size):
+  """The cursor stops at the edges, fraction and all."""
+  return min(size - 1.0, max(0.0, v))
+
+def axis_jumps(p, u, target, size, use_stick):
+  """Ways to bring one axis from p (off by up to u) onto the pixel target:
+  hold the stick for n frames (signed), then tap the rest. Yields (n, taps,
+  landing, error) for every n whose landing rounds to target however far
+  the game is off. The stick never runs into an edge, where it would stop."""
+  dist = target - p
+  sign = 1 if dist > 0 else -1
+  longest = bisect.bisect_right(STICK_TRAVEL, abs(dist) + 0.5) - 1
+  for n in [0] + (list(range(max(1, longest - 2), min(longest + 2, len(STICK_TRAVEL)))) if use_stick else []):
+    q = p + sign * STICK_TRAVEL[n]
+    error = u + STICK_TOLERANCE * STICK_TRAVEL[n]
+    if n and (q - error < 0 or q + error > size - 1):
+      continue
+    taps = target - nearest_pixel(q)
+    if abs(q + taps - target) + error < 0.5:
+      yield sign * n, taps, clamp(q + taps, size), error
+
+def home_frames(cursor):
+  """Frames that push the cursor into the top left corner from wherever it may be."""
+  distance = max(cursor.x + cursor.ux, cursor.y + cursor.uy)
+  n = bisect.bisect_left(STICK_TRAVEL, distance / (1 - STICK_TOLERANCE))
+  return min(n, len(STICK_TRAVEL) - 1) + HOME_OVERDRIVE
+
+def travel(cursor, x, y, use_stick=True):
+  """The ops that bring the cursor to pixel (x, y) in the fewest frames: HAT
+  taps, or a jump with the stick and taps, straight or from the top left
+  corner after a re-home. Updates the cursor."""
+  homed = Cursor()
+  starts = [(cursor, [])]
+  if use_stick:
+    starts.append((homed, [("home", home_frames(cursor))]))
+  best = None
+  for start, ops in starts:
+    base = cost(ops)
+    for nx, kx, lx, ex in axis_jumps(start.x, start.ux, x, WIDTH, use_stick):
+      for ny, ky, ly, ey in axis_jumps(start.y, start.uy, y, HEIGHT, use_stick):
+        frames = base + jump_frames(nx, ny) + move_frames(kx, ky)
+        if best is None or frames < best[0]:
+          best = (frames, ops + ([("jump", nx, ny)] if nx or ny else []) + ([("move", kx, ky)] if kx or ky else []),
+                  (lx, ly, ex, ey))
+  frames, ops, (cursor.x, cursor.y, cursor.ux, cursor.uy) = best
+  return ops
+
+# ---------------------------------------------------------------- planning
+
+class Plan(object):
+  def __init__(self, ops, used, strokes, pixels, upright):
+    self.ops, self.used, self.strokes, self.pixels, self.upright = ops, used, strokes, pixels, upright
+    self.frames = cost(ops)
+    self.jumps = sum(1 for op in ops if op[0] == "jump")
+    self.homes = sum(1 for op in ops if op[0] == "home")
+
+def plan(rows, large, upright, start=START_BRUSH, use_stick=True):
+  """Plan with the given large brush indices (largest first), then the 1-pixel brush."""
+  left = list(rows)
+  passes = []
+  for index in sorted(large, reverse=True):
+    before = sum(popcount(row) for row in left)
+    strokes = cover(left, centers(rows, BRUSHES[index]), BRUSHES[index])
+    if strokes:
+      passes.append((index, strokes, before - sum(popcount(row) for row in left)))
+  passes.append((0, fine_strokes(rows, left, upright), sum(popcount(row) for row in left)))
+
+  ops, used, strokes, pixels = [], [], {}, {}
+  brush, x, y = start, 0, 0               # the cursor starts homed at the top left
+  cursor = Cursor()
+  for index, pass_strokes, pass_pixels in passes:
+    if not pass_strokes:
+      continue
+    if index != brush:
+      ops.append(("brush", brush, index))
+      brush = index
+    used.append(index)
+    strokes[index], pixels[index] = len(pass_strokes), pass_pixels
+    if len(pass_strokes) <= NEAREST_LIMIT:
+      ordered = nearest(pass_strokes, x, y)
+    else:
+      ordered = serpentine(pass_strokes)
+    for x0, y0, x1, y1 in ordered:
+      if (x0, y0) != (x, y):
+        ops.extend(travel(cursor, x0, y0, use_stick))
+      ops.append(("stroke", x1 - x0, y1 - y0))
+      cursor.x = clamp(cursor.x + x1 - x0, WIDTH)
+      cursor.y = clamp(cursor.y + y1 - y0, HEIGHT)
+      x, y = x1, y1
+  return Plan(ops, used, strokes, pixels, upright)
+
+def best_plan(rows, start=START_BRUSH, use_stick=True):
+  """Try every set of large brushes, with and without vertical 1-pixel
+  strokes, and keep the plan with the fewest frames."""
+  best = None
+  candidates = list(range(1, len(BRUSHES)))
+  for subset in range(1 << len(candidates)):
+    large = [candidates[i] for i in range(len(candidates)) if subset >> i & 1]
+    for upright in (False, True):
+      candidate = plan(rows, large, upright, start, use_stick)
+      if best is None or candidate.frames < best.frames:
+        best = candidate
+  return best
+
+def calibration():
+  """A plan that measures the stick: for every hold in CALIBRATE, re-home,
+  tap down to a row of its own, jump right for that many frames and draw a
+  dot. The column of each dot is the travel for its hold (read with --stick)."""
+  ops = []
+  for row, frames in enumerate(CALIBRATE):
+    ops += [("home", home_frames(Cursor()) + len(STICK_TRAVEL)), ("move", 0, 6 * row),
+            ("jump", frames, 0), ("stroke", 0, 0)]
+  return ops
+
+def pixel_by_pixel(rows):
+  """Frames to print visiting every pixel and pressing A on the dark ones."""
+  return move_frames(1, 0) * (WIDTH * HEIGHT - 1) + TAP * sum(popcount(row) for row in rows)
+
+# ---------------------------------------------------------------- output
+
+def main(argv):
+  global BRUSHES, STICK_TRAVEL
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("image", nargs="?", default="image.c", help="image.c, a .data file or a PNG (default image.c)")
+  parser.add_argument("-i", "--invert", action="store_true", help="print the light pixels instead of the dark ones")
+  parser.add_argument("-b", "--brushes", help="brush sizes, smallest first (default {})".format(",".join(map(str, BRUSHES))))
+  parser.add_argument("-1", "--fine-only", action="store_true", help="plan with the 1-pixel brush only")
+  parser.add_argument("-H", "--hat-only", action="store_true", help="travel between strokes with HAT taps only")
+  parser.add_argument("-s", "--stick", help="the measured stick travel: lines of <frames> <pixels>")
+  parser.add_argument("--calibrate", action="store_true", help="write the print that measures the stick travel to -o instead")
+  parser.add_argument("-o", "--ops", help="write the plan to this file")
+  parser.add_argument("--fps", type=float, default=1000.0 / 24, help="frames per second (default: 3 polls of 8 ms)")
+  args = parser.parse_args(argv)
+
+  if args.brushes:
+    BRUSHES = [int(s) for s in args.brushes.split(",")]
+    if BRUSHES[0] != 1 or any(s % 2 == 0 for s in BRUSHES) or BRUSHES != sorted(BRUSHES):
+      print("strokes: brush sizes must be odd and ascending from 1")
+      return 2
+  try:
+    if args.stick:
+      STICK_TRAVEL = read_stick(args.stick)
+    if args.calibrate:
+      if not args.ops:
+        print("strokes: --calibrate writes its plan to -o")
+        return 2
+      chosen = Plan(calibration(), [0], {}, {}, False)
+      print("calibration print: {} frames; the dot of row {} is the travel after {} frames".format(
+        chosen.frames, " ".join("{}".format(6 * i) for i in range(len(CALIBRATE))), " ".join(map(str, CALIBRATE))))
+      args.image = None
+    else:
+      rows = read_image(args.image, args.invert)
+  except (IOError, ValueError, ImageError) as e:
+    print("strokes: {}".format(e))
+    return 2
+
+  if args.image:
+    use_stick = not args.hat_only
+    fine = min((plan(rows, [], upright, use_stick=use_stick) for upright in (False, True)), key=lambda p: p.frames)
+    chosen = fine if args.fine_only else best_plan(rows, use_stick=use_stick)
+    hat = plan(rows, [i for i in chosen.used if i], chosen.upright, use_stick=False)
+    baseline = pixel_by_pixel(rows)
+
+    dark = sum(popcount(row) for row in rows)
+    print("{}: {} pixels to draw".format(args.image, dark))
+    for index in sorted(chosen.used, reverse=True):
+      print("  brush {:>2} px: {:>5} strokes, {:>5} pixels".format(BRUSHES[index], chosen.strokes[index], chosen.pixels[index]))
+    print("  travel: {} stick jumps, {} re-homes".format(chosen.jumps, chosen.homes))
+    # The speed-ups rest on the stick travel, so they are only shown once it is measured.
+    for name, frames in (("pixel by pixel", baseline), ("1-pixel strokes", fine.frames),
+                         ("HAT travel", hat.frames), ("planned", chosen.frames)):
+      print("{:<16} {:>8} frames {:>8.1f} min".format(name, frames, frames / args.fps / 60) +
+            (" {:>6.1f}x".format(baseline / float(max(1, frames))) if args.stick else ""))
+    if not args.stick:
+      print("(the stick travel is the model, not a measured one: pass -s for the speed-ups)")
+
+  if args.ops:
+    with open(args.ops, "w") as f:
+      for op in chosen.ops:
+        f.write(" ".join(map(str, op)) + "\n")
+  return 0
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))